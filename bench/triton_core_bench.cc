@@ -0,0 +1,1128 @@
+// Copyright 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// Microbenchmarks of the per-call cost of the hot paths of the Triton
+// Server and Backend APIs, run against the loopback server library.
+//
+// Usage: triton-core-bench [--benchmark_filter=<substring>]
+//                          [--benchmark_min_time=<seconds>]
+//                          [--benchmark_out=<json file>]
+//
+// Results are printed as a table and, with --benchmark_out, written as
+// JSON in the same layout as Google Benchmark so that results from
+// different releases can be compared with the same tools.
+//
+// The TRITONBACKEND benchmarks rely on the loopback server using the
+// same object for a TRITONSERVER_InferenceRequest and a
+// TRITONBACKEND_Request, so that the backend side of a request can be
+// exercised from outside a backend.
+//
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "triton/core/tritonbackend.h"
+#include "triton/core/tritonserver.h"
+
+namespace {
+
+#define FAIL_IF_ERR(X, MSG)                                        \
+  do {                                                             \
+    TRITONSERVER_Error* err__ = (X);                               \
+    if (err__ != nullptr) {                                        \
+      fprintf(                                                     \
+          stderr, "error: %s: %s - %s\n", (MSG),                   \
+          TRITONSERVER_ErrorCodeString(err__),                     \
+          TRITONSERVER_ErrorMessage(err__));                       \
+      TRITONSERVER_ErrorDelete(err__);                             \
+      exit(1);                                                     \
+    }                                                              \
+  } while (false)
+
+// The largest sweep values, the loopback model is configured with
+// enough inputs and instances to cover them.
+constexpr uint32_t kMaxTensorCount = 16;
+constexpr uint32_t kMaxThreadCount = 8;
+
+const std::vector<uint32_t> kTensorCounts{1, 4, 16};
+const std::vector<uint64_t> kTensorByteSizes{64, 4096, 1 << 20};
+const std::vector<uint32_t> kThreadCounts{1, 2, 4, 8};
+const std::vector<uint32_t> kBatchSizes{1, 4, 16};
+
+const char* kModelName = "loopback";
+
+std::string
+InputName(const uint32_t idx)
+{
+  return "INPUT" + std::to_string(idx);
+}
+
+uint64_t
+ThreadCpuNs()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+}
+
+//
+// Response allocator that allocates with malloc, as a simple client
+// would.
+//
+TRITONSERVER_Error*
+ResponseAlloc(
+    TRITONSERVER_ResponseAllocator* allocator, const char* tensor_name,
+    size_t byte_size, TRITONSERVER_MemoryType preferred_memory_type,
+    int64_t preferred_memory_type_id, void* userp, void** buffer,
+    void** buffer_userp, TRITONSERVER_MemoryType* actual_memory_type,
+    int64_t* actual_memory_type_id)
+{
+  *buffer = malloc(std::max<size_t>(byte_size, 1));
+  *buffer_userp = nullptr;
+  *actual_memory_type = TRITONSERVER_MEMORY_CPU;
+  *actual_memory_type_id = 0;
+  return nullptr;  // success
+}
+
+TRITONSERVER_Error*
+ResponseRelease(
+    TRITONSERVER_ResponseAllocator* allocator, void* buffer,
+    void* buffer_userp, size_t byte_size, TRITONSERVER_MemoryType memory_type,
+    int64_t memory_type_id)
+{
+  free(buffer);
+  return nullptr;  // success
+}
+
+//
+// Completion of one in-flight request, signalled by the release and
+// response callbacks.
+//
+struct Completion {
+  Completion() : released_(false), response_(nullptr) {}
+
+  void Reset()
+  {
+    released_ = false;
+    response_ = nullptr;
+  }
+
+  // Wait for the request to be released and its response to be
+  // delivered, returning the response.
+  TRITONSERVER_InferenceResponse* Wait()
+  {
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [this] { return released_ && (response_ != nullptr); });
+    return response_;
+  }
+
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool released_;
+  TRITONSERVER_InferenceResponse* response_;
+};
+
+void
+RequestRelease(
+    TRITONSERVER_InferenceRequest* request, const uint32_t flags, void* userp)
+{
+  Completion* completion = reinterpret_cast<Completion*>(userp);
+  {
+    std::lock_guard<std::mutex> lock(completion->mu_);
+    completion->released_ = true;
+  }
+  completion->cv_.notify_one();
+}
+
+void
+ResponseComplete(
+    TRITONSERVER_InferenceResponse* response, const uint32_t flags,
+    void* userp)
+{
+  Completion* completion = reinterpret_cast<Completion*>(userp);
+  {
+    std::lock_guard<std::mutex> lock(completion->mu_);
+    completion->response_ = response;
+  }
+  completion->cv_.notify_one();
+}
+
+// Batch response callback that deletes every response it is given.
+void
+ResponseBatchDelete(
+    TRITONSERVER_InferenceResponse** responses, const uint32_t* flags,
+    void** userps, const uint32_t response_count)
+{
+  for (uint32_t r = 0; r < response_count; ++r) {
+    if (responses[r] != nullptr) {
+      FAIL_IF_ERR(
+          TRITONSERVER_InferenceResponseDelete(responses[r]),
+          "deleting response");
+    }
+  }
+}
+
+//
+// The server and allocator shared by all benchmarks.
+//
+struct Environment {
+  TRITONSERVER_Server* server_;
+  TRITONSERVER_ResponseAllocator* allocator_;
+  std::vector<char> data_;
+};
+
+Environment*
+CreateEnvironment()
+{
+  std::unique_ptr<Environment> env(new Environment());
+
+  TRITONSERVER_ServerOptions* options;
+  FAIL_IF_ERR(TRITONSERVER_ServerOptionsNew(&options), "creating options");
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerOptionsSetLogInfo(options, false),
+      "disabling info logging");
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerOptionsSetBackendConfig(
+          options, "loopback", "model-name", kModelName),
+      "setting model name");
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerOptionsSetBackendConfig(
+          options, "loopback", "input-count",
+          std::to_string(kMaxTensorCount).c_str()),
+      "setting input count");
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerOptionsSetBackendConfig(
+          options, "loopback", "instance-count",
+          std::to_string(kMaxThreadCount).c_str()),
+      "setting instance count");
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerNew(&env->server_, options), "creating server");
+  FAIL_IF_ERR(TRITONSERVER_ServerOptionsDelete(options), "deleting options");
+
+  FAIL_IF_ERR(
+      TRITONSERVER_ResponseAllocatorNew(
+          &env->allocator_, ResponseAlloc, ResponseRelease,
+          nullptr /* start_fn */),
+      "creating response allocator");
+
+  env->data_.assign(kTensorByteSizes.back(), 1);
+  return env.release();
+}
+
+void
+DeleteEnvironment(Environment* env)
+{
+  FAIL_IF_ERR(
+      TRITONSERVER_ResponseAllocatorDelete(env->allocator_),
+      "deleting response allocator");
+  FAIL_IF_ERR(TRITONSERVER_ServerStop(env->server_), "stopping server");
+  FAIL_IF_ERR(TRITONSERVER_ServerDelete(env->server_), "deleting server");
+  delete env;
+}
+
+// Create a request with 'tensor_count' UINT8 inputs of 'byte_size'
+// bytes each, without input data.
+TRITONSERVER_InferenceRequest*
+CreateRequest(
+    Environment* env, const uint32_t tensor_count, const uint64_t byte_size)
+{
+  TRITONSERVER_InferenceRequest* request;
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestNew(&request, env->server_, kModelName, -1),
+      "creating request");
+  const int64_t shape = byte_size;
+  for (uint32_t t = 0; t < tensor_count; ++t) {
+    FAIL_IF_ERR(
+        TRITONSERVER_InferenceRequestAddInput(
+            request, InputName(t).c_str(), TRITONSERVER_TYPE_UINT8, &shape, 1),
+        "adding input");
+  }
+  return request;
+}
+
+void
+AppendInputData(
+    Environment* env, TRITONSERVER_InferenceRequest* request,
+    const uint32_t tensor_count, const uint64_t byte_size,
+    const uint32_t buffer_count = 1)
+{
+  const uint64_t buffer_byte_size = byte_size / buffer_count;
+  for (uint32_t t = 0; t < tensor_count; ++t) {
+    const std::string name = InputName(t);
+    for (uint32_t b = 0; b < buffer_count; ++b) {
+      FAIL_IF_ERR(
+          TRITONSERVER_InferenceRequestAppendInputData(
+              request, name.c_str(), env->data_.data() + b * buffer_byte_size,
+              buffer_byte_size, TRITONSERVER_MEMORY_CPU, 0),
+          "appending input data");
+    }
+  }
+}
+
+//
+// Benchmark registration and measurement.
+//
+struct Benchmark {
+  std::string name_;
+  uint32_t thread_count_;
+
+  // Bytes and items processed by one iteration, 0 if not meaningful.
+  uint64_t bytes_per_iteration_;
+  uint64_t items_per_iteration_;
+
+  // Run 'iterations' iterations on thread 'thread_idx'. Per-thread
+  // setup and teardown are done inside the function so that the
+  // measured time includes only the loop bounded by the
+  // 'start' and 'stop' callbacks.
+  std::function<void(
+      Environment* env, uint32_t thread_idx, uint64_t iterations,
+      const std::function<void()>& start, const std::function<void()>& stop)>
+      fn_;
+};
+
+struct Result {
+  std::string name_;
+  uint32_t thread_count_;
+  uint64_t iterations_;
+  double real_time_ns_;
+  double cpu_time_ns_;
+  double bytes_per_second_;
+  double items_per_second_;
+};
+
+// Run each of the threads of a benchmark for 'iterations' iterations
+// and return the wall clock and summed CPU time of the measured loops.
+void
+RunOnce(
+    Environment* env, const Benchmark& benchmark, const uint64_t iterations,
+    double* wall_ns, double* cpu_ns)
+{
+  const uint32_t thread_count = benchmark.thread_count_;
+
+  // All threads start the measured loop together.
+  std::mutex mu;
+  std::condition_variable cv;
+  uint32_t ready_count = 0;
+  bool go = false;
+  std::atomic<uint64_t> total_cpu_ns(0);
+  std::chrono::steady_clock::time_point start_time, end_time;
+  std::atomic<uint32_t> done_count(0);
+
+  std::vector<std::thread> threads;
+  for (uint32_t idx = 0; idx < thread_count; ++idx) {
+    threads.emplace_back([&, idx] {
+      uint64_t cpu_start_ns = 0;
+      auto start = [&] {
+        std::unique_lock<std::mutex> lock(mu);
+        if (++ready_count == thread_count) {
+          start_time = std::chrono::steady_clock::now();
+          go = true;
+          cv.notify_all();
+        } else {
+          cv.wait(lock, [&] { return go; });
+        }
+        cpu_start_ns = ThreadCpuNs();
+      };
+      auto stop = [&] {
+        total_cpu_ns += ThreadCpuNs() - cpu_start_ns;
+        if (++done_count == thread_count) {
+          end_time = std::chrono::steady_clock::now();
+        }
+      };
+      benchmark.fn_(env, idx, iterations, start, stop);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  *wall_ns =
+      std::chrono::duration<double, std::nano>(end_time - start_time).count();
+  *cpu_ns = total_cpu_ns.load();
+}
+
+// The name of a benchmark run, with the thread count suffix used by
+// Google Benchmark.
+std::string
+RunName(const Benchmark& benchmark)
+{
+  if (benchmark.thread_count_ > 1) {
+    return benchmark.name_ + "/threads:" +
+           std::to_string(benchmark.thread_count_);
+  }
+  return benchmark.name_;
+}
+
+Result
+Run(Environment* env, const Benchmark& benchmark, const double min_time_s)
+{
+  // Grow the iteration count until the run takes at least the minimum
+  // time, as Google Benchmark does.
+  const double min_time_ns = min_time_s * 1e9;
+  uint64_t iterations = 1;
+  double wall_ns = 0, cpu_ns = 0;
+  while (true) {
+    RunOnce(env, benchmark, iterations, &wall_ns, &cpu_ns);
+    if ((wall_ns >= min_time_ns) || (iterations >= 1000000000)) {
+      break;
+    }
+
+    const double multiplier =
+        (wall_ns <= (min_time_ns / 10)) ? 10 : (min_time_ns * 1.4 / wall_ns);
+    iterations = std::max<uint64_t>(iterations + 1, iterations * multiplier);
+  }
+
+  Result result;
+  result.name_ = RunName(benchmark);
+  result.thread_count_ = benchmark.thread_count_;
+  result.iterations_ = iterations;
+  result.real_time_ns_ = wall_ns / iterations;
+  result.cpu_time_ns_ = cpu_ns / (iterations * benchmark.thread_count_);
+
+  const double total_iterations =
+      static_cast<double>(iterations) * benchmark.thread_count_;
+  const double wall_s = wall_ns / 1e9;
+  result.bytes_per_second_ =
+      benchmark.bytes_per_iteration_ * total_iterations / wall_s;
+  result.items_per_second_ =
+      benchmark.items_per_iteration_ * total_iterations / wall_s;
+  return result;
+}
+
+//
+// Benchmarks.
+//
+
+// TRITONSERVER_InferenceRequestNew, AddInput, AppendInputData and
+// Delete for every iteration.
+void
+RegisterRequestLifecycle(std::vector<Benchmark>* benchmarks)
+{
+  for (const uint32_t tensor_count : kTensorCounts) {
+    Benchmark benchmark;
+    benchmark.name_ =
+        "BM_RequestLifecycle/" + std::to_string(tensor_count) + "/64";
+    benchmark.thread_count_ = 1;
+    benchmark.bytes_per_iteration_ = 0;
+    benchmark.items_per_iteration_ = tensor_count;
+    benchmark.fn_ = [tensor_count](
+                        Environment* env, uint32_t thread_idx,
+                        uint64_t iterations, const std::function<void()>& start,
+                        const std::function<void()>& stop) {
+      start();
+      for (uint64_t i = 0; i < iterations; ++i) {
+        TRITONSERVER_InferenceRequest* request =
+            CreateRequest(env, tensor_count, 64);
+        AppendInputData(env, request, tensor_count, 64);
+        FAIL_IF_ERR(
+            TRITONSERVER_InferenceRequestDelete(request), "deleting request");
+      }
+      stop();
+    };
+    benchmarks->push_back(benchmark);
+  }
+}
+
+// TRITONSERVER_InferenceRequestReset and AppendInputData, the cost of
+// reusing a request with the same signature.
+void
+RegisterRequestReuse(std::vector<Benchmark>* benchmarks)
+{
+  for (const uint32_t tensor_count : kTensorCounts) {
+    Benchmark benchmark;
+    benchmark.name_ = "BM_RequestReuse/" + std::to_string(tensor_count) + "/64";
+    benchmark.thread_count_ = 1;
+    benchmark.bytes_per_iteration_ = 0;
+    benchmark.items_per_iteration_ = tensor_count;
+    benchmark.fn_ = [tensor_count](
+                        Environment* env, uint32_t thread_idx,
+                        uint64_t iterations, const std::function<void()>& start,
+                        const std::function<void()>& stop) {
+      TRITONSERVER_InferenceRequest* request =
+          CreateRequest(env, tensor_count, 64);
+      start();
+      for (uint64_t i = 0; i < iterations; ++i) {
+        FAIL_IF_ERR(
+            TRITONSERVER_InferenceRequestReset(request), "resetting request");
+        AppendInputData(env, request, tensor_count, 64);
+      }
+      stop();
+      FAIL_IF_ERR(
+          TRITONSERVER_InferenceRequestDelete(request), "deleting request");
+    };
+    benchmarks->push_back(benchmark);
+  }
+}
+
+// TRITONSERVER_ServerInferAsync round trip, from appending the input
+// data to the response and release callbacks, including iterating the
+// response outputs and deleting the response.
+void
+RegisterInferAsyncRoundTrip(std::vector<Benchmark>* benchmarks)
+{
+  for (const uint32_t thread_count : kThreadCounts) {
+    for (const uint32_t tensor_count : kTensorCounts) {
+      for (const uint64_t byte_size : kTensorByteSizes) {
+        Benchmark benchmark;
+        benchmark.name_ = "BM_InferAsyncRoundTrip/" +
+                          std::to_string(tensor_count) + "/" +
+                          std::to_string(byte_size);
+        benchmark.thread_count_ = thread_count;
+        benchmark.bytes_per_iteration_ = tensor_count * byte_size;
+        benchmark.items_per_iteration_ = 1;
+        benchmark.fn_ = [tensor_count, byte_size](
+                            Environment* env, uint32_t thread_idx,
+                            uint64_t iterations,
+                            const std::function<void()>& start,
+                            const std::function<void()>& stop) {
+          Completion completion;
+          TRITONSERVER_InferenceRequest* request =
+              CreateRequest(env, tensor_count, byte_size);
+          FAIL_IF_ERR(
+              TRITONSERVER_InferenceRequestSetReleaseCallback(
+                  request, RequestRelease, &completion),
+              "setting release callback");
+          FAIL_IF_ERR(
+              TRITONSERVER_InferenceRequestSetResponseCallback(
+                  request, env->allocator_, nullptr, ResponseComplete,
+                  &completion),
+              "setting response callback");
+
+          start();
+          for (uint64_t i = 0; i < iterations; ++i) {
+            FAIL_IF_ERR(
+                TRITONSERVER_InferenceRequestReset(request),
+                "resetting request");
+            AppendInputData(env, request, tensor_count, byte_size);
+            completion.Reset();
+            FAIL_IF_ERR(
+                TRITONSERVER_ServerInferAsync(env->server_, request, nullptr),
+                "running inference");
+
+            TRITONSERVER_InferenceResponse* response = completion.Wait();
+            FAIL_IF_ERR(
+                TRITONSERVER_InferenceResponseError(response),
+                "response status");
+            uint32_t output_count;
+            FAIL_IF_ERR(
+                TRITONSERVER_InferenceResponseOutputCount(
+                    response, &output_count),
+                "getting output count");
+            for (uint32_t o = 0; o < output_count; ++o) {
+              const char* name;
+              TRITONSERVER_DataType datatype;
+              const int64_t* shape;
+              uint64_t dim_count;
+              const void* base;
+              size_t output_byte_size;
+              TRITONSERVER_MemoryType memory_type;
+              int64_t memory_type_id;
+              void* userp;
+              FAIL_IF_ERR(
+                  TRITONSERVER_InferenceResponseOutput(
+                      response, o, &name, &datatype, &shape, &dim_count,
+                      &base, &output_byte_size, &memory_type, &memory_type_id,
+                      &userp),
+                  "getting output");
+            }
+            FAIL_IF_ERR(
+                TRITONSERVER_InferenceResponseDelete(response),
+                "deleting response");
+          }
+          stop();
+
+          FAIL_IF_ERR(
+              TRITONSERVER_InferenceRequestDelete(request),
+              "deleting request");
+        };
+        benchmarks->push_back(benchmark);
+      }
+    }
+  }
+}
+
+// TRITONSERVER_ServerInferAsyncBatch round trip of 'batch_size'
+// requests with one 64 byte input each, from appending the input data
+// to the response and release callbacks of every request of the batch.
+void
+RegisterInferAsyncBatch(std::vector<Benchmark>* benchmarks)
+{
+  for (const uint32_t thread_count : kThreadCounts) {
+    for (const uint32_t batch_size : kBatchSizes) {
+      Benchmark benchmark;
+      benchmark.name_ = "BM_InferAsyncBatch/" + std::to_string(batch_size);
+      benchmark.thread_count_ = thread_count;
+      benchmark.bytes_per_iteration_ = batch_size * 64;
+      benchmark.items_per_iteration_ = batch_size;
+      benchmark.fn_ = [batch_size](
+                          Environment* env, uint32_t thread_idx,
+                          uint64_t iterations,
+                          const std::function<void()>& start,
+                          const std::function<void()>& stop) {
+        std::vector<Completion> completions(batch_size);
+        std::vector<TRITONSERVER_InferenceRequest*> requests;
+        for (uint32_t r = 0; r < batch_size; ++r) {
+          TRITONSERVER_InferenceRequest* request = CreateRequest(env, 1, 64);
+          FAIL_IF_ERR(
+              TRITONSERVER_InferenceRequestSetReleaseCallback(
+                  request, RequestRelease, &completions[r]),
+              "setting release callback");
+          FAIL_IF_ERR(
+              TRITONSERVER_InferenceRequestSetResponseCallback(
+                  request, env->allocator_, nullptr, ResponseComplete,
+                  &completions[r]),
+              "setting response callback");
+          requests.push_back(request);
+        }
+
+        start();
+        for (uint64_t i = 0; i < iterations; ++i) {
+          for (uint32_t r = 0; r < batch_size; ++r) {
+            FAIL_IF_ERR(
+                TRITONSERVER_InferenceRequestReset(requests[r]),
+                "resetting request");
+            AppendInputData(env, requests[r], 1, 64);
+            completions[r].Reset();
+          }
+          FAIL_IF_ERR(
+              TRITONSERVER_ServerInferAsyncBatch(
+                  env->server_, requests.data(), batch_size, nullptr),
+              "running inference");
+
+          for (auto& completion : completions) {
+            TRITONSERVER_InferenceResponse* response = completion.Wait();
+            FAIL_IF_ERR(
+                TRITONSERVER_InferenceResponseError(response),
+                "response status");
+            FAIL_IF_ERR(
+                TRITONSERVER_InferenceResponseDelete(response),
+                "deleting response");
+          }
+        }
+        stop();
+
+        for (auto request : requests) {
+          FAIL_IF_ERR(
+              TRITONSERVER_InferenceRequestDelete(request),
+              "deleting request");
+        }
+      };
+      benchmarks->push_back(benchmark);
+    }
+  }
+}
+
+// TRITONSERVER_InferenceResponseOutputCount and
+// TRITONSERVER_InferenceResponseOutput over all outputs of a response.
+void
+RegisterResponseOutputIteration(std::vector<Benchmark>* benchmarks)
+{
+  for (const uint32_t tensor_count : kTensorCounts) {
+    Benchmark benchmark;
+    benchmark.name_ = "BM_ResponseOutputIteration/" +
+                      std::to_string(tensor_count) + "/64";
+    benchmark.thread_count_ = 1;
+    benchmark.bytes_per_iteration_ = 0;
+    benchmark.items_per_iteration_ = tensor_count;
+    benchmark.fn_ = [tensor_count](
+                        Environment* env, uint32_t thread_idx,
+                        uint64_t iterations, const std::function<void()>& start,
+                        const std::function<void()>& stop) {
+      Completion completion;
+      TRITONSERVER_InferenceRequest* request =
+          CreateRequest(env, tensor_count, 64);
+      AppendInputData(env, request, tensor_count, 64);
+      FAIL_IF_ERR(
+          TRITONSERVER_InferenceRequestSetReleaseCallback(
+              request, RequestRelease, &completion),
+          "setting release callback");
+      FAIL_IF_ERR(
+          TRITONSERVER_InferenceRequestSetResponseCallback(
+              request, env->allocator_, nullptr, ResponseComplete,
+              &completion),
+          "setting response callback");
+      FAIL_IF_ERR(
+          TRITONSERVER_ServerInferAsync(env->server_, request, nullptr),
+          "running inference");
+      TRITONSERVER_InferenceResponse* response = completion.Wait();
+
+      size_t total_byte_size = 0;
+      start();
+      for (uint64_t i = 0; i < iterations; ++i) {
+        uint32_t output_count;
+        FAIL_IF_ERR(
+            TRITONSERVER_InferenceResponseOutputCount(response, &output_count),
+            "getting output count");
+        for (uint32_t o = 0; o < output_count; ++o) {
+          const char* name;
+          TRITONSERVER_DataType datatype;
+          const int64_t* shape;
+          uint64_t dim_count;
+          const void* base;
+          size_t byte_size;
+          TRITONSERVER_MemoryType memory_type;
+          int64_t memory_type_id;
+          void* userp;
+          FAIL_IF_ERR(
+              TRITONSERVER_InferenceResponseOutput(
+                  response, o, &name, &datatype, &shape, &dim_count, &base,
+                  &byte_size, &memory_type, &memory_type_id, &userp),
+              "getting output");
+          total_byte_size += byte_size;
+        }
+      }
+      stop();
+
+      if (total_byte_size != (iterations * tensor_count * 64)) {
+        fprintf(stderr, "error: unexpected response output size\n");
+        exit(1);
+      }
+      FAIL_IF_ERR(
+          TRITONSERVER_InferenceResponseDelete(response), "deleting response");
+      FAIL_IF_ERR(
+          TRITONSERVER_InferenceRequestDelete(request), "deleting request");
+    };
+    benchmarks->push_back(benchmark);
+  }
+}
+
+// TRITONBACKEND_RequestInput, InputProperties and InputBuffer over all
+// buffers of all inputs of a request.
+void
+RegisterBackendInputBuffer(std::vector<Benchmark>* benchmarks)
+{
+  for (const uint32_t tensor_count : kTensorCounts) {
+    for (const uint32_t buffer_count : {1, 8}) {
+      Benchmark benchmark;
+      benchmark.name_ = "BM_BackendInputBuffer/" +
+                        std::to_string(tensor_count) + "/" +
+                        std::to_string(buffer_count);
+      benchmark.thread_count_ = 1;
+      benchmark.bytes_per_iteration_ = 0;
+      benchmark.items_per_iteration_ = tensor_count * buffer_count;
+      benchmark.fn_ = [tensor_count, buffer_count](
+                          Environment* env, uint32_t thread_idx,
+                          uint64_t iterations,
+                          const std::function<void()>& start,
+                          const std::function<void()>& stop) {
+        TRITONSERVER_InferenceRequest* request =
+            CreateRequest(env, tensor_count, 4096);
+        AppendInputData(env, request, tensor_count, 4096, buffer_count);
+        TRITONBACKEND_Request* backend_request =
+            reinterpret_cast<TRITONBACKEND_Request*>(request);
+        std::vector<std::string> names;
+        for (uint32_t t = 0; t < tensor_count; ++t) {
+          names.emplace_back(InputName(t));
+        }
+
+        start();
+        for (uint64_t i = 0; i < iterations; ++i) {
+          for (const auto& name : names) {
+            TRITONBACKEND_Input* input;
+            FAIL_IF_ERR(
+                TRITONBACKEND_RequestInput(
+                    backend_request, name.c_str(), &input),
+                "getting input");
+            uint32_t input_buffer_count;
+            FAIL_IF_ERR(
+                TRITONBACKEND_InputProperties(
+                    input, nullptr, nullptr, nullptr, nullptr, nullptr,
+                    &input_buffer_count),
+                "getting input properties");
+            for (uint32_t b = 0; b < input_buffer_count; ++b) {
+              const void* buffer;
+              uint64_t buffer_byte_size;
+              TRITONSERVER_MemoryType memory_type = TRITONSERVER_MEMORY_CPU;
+              int64_t memory_type_id = 0;
+              FAIL_IF_ERR(
+                  TRITONBACKEND_InputBuffer(
+                      input, b, &buffer, &buffer_byte_size, &memory_type,
+                      &memory_type_id),
+                  "getting input buffer");
+            }
+          }
+        }
+        stop();
+
+        FAIL_IF_ERR(
+            TRITONSERVER_InferenceRequestDelete(request), "deleting request");
+      };
+      benchmarks->push_back(benchmark);
+    }
+  }
+}
+
+// TRITONBACKEND_ResponseNew, ResponseOutput, OutputBuffer and
+// ResponseDelete, which call the response allocator's allocation and
+// release functions once per output.
+void
+RegisterBackendOutputBuffer(std::vector<Benchmark>* benchmarks)
+{
+  for (const uint32_t tensor_count : kTensorCounts) {
+    for (const uint64_t byte_size : kTensorByteSizes) {
+      Benchmark benchmark;
+      benchmark.name_ = "BM_BackendOutputBuffer/" +
+                        std::to_string(tensor_count) + "/" +
+                        std::to_string(byte_size);
+      benchmark.thread_count_ = 1;
+      benchmark.bytes_per_iteration_ = 0;
+      benchmark.items_per_iteration_ = tensor_count;
+      benchmark.fn_ = [tensor_count, byte_size](
+                          Environment* env, uint32_t thread_idx,
+                          uint64_t iterations,
+                          const std::function<void()>& start,
+                          const std::function<void()>& stop) {
+        Completion completion;
+        TRITONSERVER_InferenceRequest* request =
+            CreateRequest(env, tensor_count, byte_size);
+        FAIL_IF_ERR(
+            TRITONSERVER_InferenceRequestSetResponseCallback(
+                request, env->allocator_, nullptr, ResponseComplete,
+                &completion),
+            "setting response callback");
+        TRITONBACKEND_Request* backend_request =
+            reinterpret_cast<TRITONBACKEND_Request*>(request);
+        std::vector<std::string> names;
+        for (uint32_t t = 0; t < tensor_count; ++t) {
+          names.emplace_back("OUTPUT" + std::to_string(t));
+        }
+        const int64_t shape = byte_size;
+
+        start();
+        for (uint64_t i = 0; i < iterations; ++i) {
+          TRITONBACKEND_Response* response;
+          FAIL_IF_ERR(
+              TRITONBACKEND_ResponseNew(&response, backend_request),
+              "creating response");
+          for (const auto& name : names) {
+            TRITONBACKEND_Output* output;
+            FAIL_IF_ERR(
+                TRITONBACKEND_ResponseOutput(
+                    response, &output, name.c_str(), TRITONSERVER_TYPE_UINT8,
+                    &shape, 1),
+                "creating output");
+            void* buffer;
+            TRITONSERVER_MemoryType memory_type = TRITONSERVER_MEMORY_CPU;
+            int64_t memory_type_id = 0;
+            FAIL_IF_ERR(
+                TRITONBACKEND_OutputBuffer(
+                    output, &buffer, byte_size, &memory_type,
+                    &memory_type_id),
+                "getting output buffer");
+          }
+          FAIL_IF_ERR(
+              TRITONBACKEND_ResponseDelete(response), "deleting response");
+        }
+        stop();
+
+        FAIL_IF_ERR(
+            TRITONSERVER_InferenceRequestDelete(request), "deleting request");
+      };
+      benchmarks->push_back(benchmark);
+    }
+  }
+}
+
+// TRITONBACKEND_ResponseNew for each of 'batch_size' requests and
+// TRITONBACKEND_ResponseSendBatch of the final responses, delivered
+// to the batch response callback set on every request in one call.
+void
+RegisterResponseSendBatch(std::vector<Benchmark>* benchmarks)
+{
+  for (const uint32_t batch_size : kBatchSizes) {
+    Benchmark benchmark;
+    benchmark.name_ = "BM_ResponseSendBatch/" + std::to_string(batch_size);
+    benchmark.thread_count_ = 1;
+    benchmark.bytes_per_iteration_ = 0;
+    benchmark.items_per_iteration_ = batch_size;
+    benchmark.fn_ = [batch_size](
+                        Environment* env, uint32_t thread_idx,
+                        uint64_t iterations, const std::function<void()>& start,
+                        const std::function<void()>& stop) {
+      std::vector<TRITONSERVER_InferenceRequest*> requests;
+      for (uint32_t r = 0; r < batch_size; ++r) {
+        TRITONSERVER_InferenceRequest* request = CreateRequest(env, 1, 64);
+        FAIL_IF_ERR(
+            TRITONSERVER_InferenceRequestSetResponseBatchCallback(
+                request, env->allocator_, nullptr, ResponseBatchDelete,
+                nullptr),
+            "setting response batch callback");
+        requests.push_back(request);
+      }
+      std::vector<TRITONBACKEND_Response*> responses(batch_size);
+      const std::vector<uint32_t> send_flags(
+          batch_size, TRITONSERVER_RESPONSE_COMPLETE_FINAL);
+
+      start();
+      for (uint64_t i = 0; i < iterations; ++i) {
+        for (uint32_t r = 0; r < batch_size; ++r) {
+          FAIL_IF_ERR(
+              TRITONBACKEND_ResponseNew(
+                  &responses[r],
+                  reinterpret_cast<TRITONBACKEND_Request*>(requests[r])),
+              "creating response");
+        }
+        FAIL_IF_ERR(
+            TRITONBACKEND_ResponseSendBatch(
+                responses.data(), batch_size, send_flags.data(), nullptr),
+            "sending responses");
+      }
+      stop();
+
+      for (auto request : requests) {
+        FAIL_IF_ERR(
+            TRITONSERVER_InferenceRequestDelete(request), "deleting request");
+      }
+    };
+    benchmarks->push_back(benchmark);
+  }
+}
+
+// TRITONSERVER_ServerModelStatisticsSnapshot and
+// TRITONSERVER_ServerModelStatistics, after statistics have been
+// reported by inferences.
+void
+RegisterStatistics(std::vector<Benchmark>* benchmarks)
+{
+  for (const uint32_t thread_count : kThreadCounts) {
+    Benchmark benchmark;
+    benchmark.name_ = "BM_StatisticsSnapshot";
+    benchmark.thread_count_ = thread_count;
+    benchmark.bytes_per_iteration_ = 0;
+    benchmark.items_per_iteration_ = 1;
+    benchmark.fn_ = [](Environment* env, uint32_t thread_idx,
+                       uint64_t iterations, const std::function<void()>& start,
+                       const std::function<void()>& stop) {
+      TRITONSERVER_ModelStatisticsRecord record;
+      uint32_t record_count;
+      uint64_t token;
+      start();
+      for (uint64_t i = 0; i < iterations; ++i) {
+        FAIL_IF_ERR(
+            TRITONSERVER_ServerModelStatisticsSnapshot(
+                env->server_, 0 /* since_token */, &record, 1, sizeof(record),
+                &record_count, &token),
+            "getting statistics snapshot");
+      }
+      stop();
+    };
+    benchmarks->push_back(benchmark);
+  }
+
+  Benchmark benchmark;
+  benchmark.name_ = "BM_StatisticsMessage";
+  benchmark.thread_count_ = 1;
+  benchmark.bytes_per_iteration_ = 0;
+  benchmark.items_per_iteration_ = 1;
+  benchmark.fn_ = [](Environment* env, uint32_t thread_idx,
+                     uint64_t iterations, const std::function<void()>& start,
+                     const std::function<void()>& stop) {
+    start();
+    for (uint64_t i = 0; i < iterations; ++i) {
+      TRITONSERVER_Message* message;
+      FAIL_IF_ERR(
+          TRITONSERVER_ServerModelStatistics(
+              env->server_, kModelName, -1, &message),
+          "getting statistics");
+      const char* base;
+      size_t byte_size;
+      FAIL_IF_ERR(
+          TRITONSERVER_MessageSerializeToJson(message, &base, &byte_size),
+          "serializing statistics");
+      FAIL_IF_ERR(TRITONSERVER_MessageDelete(message), "deleting message");
+    }
+    stop();
+  };
+  benchmarks->push_back(benchmark);
+}
+
+//
+// Output.
+//
+void
+PrintResult(const Result& result)
+{
+  printf(
+      "%-48s %12.0f ns %12.0f ns %12llu", result.name_.c_str(),
+      result.real_time_ns_, result.cpu_time_ns_,
+      static_cast<unsigned long long>(result.iterations_));
+  if (result.bytes_per_second_ > 0) {
+    printf(" bytes_per_second=%.4g", result.bytes_per_second_);
+  }
+  if (result.items_per_second_ > 0) {
+    printf(" items_per_second=%.4g", result.items_per_second_);
+  }
+  printf("\n");
+  fflush(stdout);
+}
+
+bool
+WriteJson(const std::string& path, const std::vector<Result>& results)
+{
+  FILE* file = fopen(path.c_str(), "w");
+  if (file == nullptr) {
+    return false;
+  }
+
+  char date[64];
+  const time_t now = time(nullptr);
+  struct tm tm_now;
+  localtime_r(&now, &tm_now);
+  strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S%z", &tm_now);
+
+  uint32_t api_major, api_minor;
+  FAIL_IF_ERR(
+      TRITONSERVER_ApiVersion(&api_major, &api_minor), "getting API version");
+
+  fprintf(file, "{\n  \"context\": {\n");
+  fprintf(file, "    \"date\": \"%s\",\n", date);
+  fprintf(
+      file, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+  fprintf(
+      file, "    \"triton_server_api_version\": \"%u.%u\",\n", api_major,
+      api_minor);
+#ifdef NDEBUG
+  fprintf(file, "    \"library_build_type\": \"release\"\n");
+#else
+  fprintf(file, "    \"library_build_type\": \"debug\"\n");
+#endif
+  fprintf(file, "  },\n  \"benchmarks\": [\n");
+  for (size_t i = 0; i < results.size(); ++i) {
+    const Result& result = results[i];
+    fprintf(file, "    {\n");
+    fprintf(file, "      \"name\": \"%s\",\n", result.name_.c_str());
+    fprintf(file, "      \"run_name\": \"%s\",\n", result.name_.c_str());
+    fprintf(file, "      \"run_type\": \"iteration\",\n");
+    fprintf(file, "      \"threads\": %u,\n", result.thread_count_);
+    fprintf(
+        file, "      \"iterations\": %llu,\n",
+        static_cast<unsigned long long>(result.iterations_));
+    fprintf(file, "      \"real_time\": %.6e,\n", result.real_time_ns_);
+    fprintf(file, "      \"cpu_time\": %.6e,\n", result.cpu_time_ns_);
+    fprintf(file, "      \"time_unit\": \"ns\"");
+    if (result.bytes_per_second_ > 0) {
+      fprintf(
+          file, ",\n      \"bytes_per_second\": %.6e",
+          result.bytes_per_second_);
+    }
+    if (result.items_per_second_ > 0) {
+      fprintf(
+          file, ",\n      \"items_per_second\": %.6e",
+          result.items_per_second_);
+    }
+    fprintf(file, "\n    }%s\n", (i + 1 < results.size()) ? "," : "");
+  }
+  fprintf(file, "  ]\n}\n");
+  return fclose(file) == 0;
+}
+
+void
+Usage(const char* program)
+{
+  fprintf(
+      stderr,
+      "Usage: %s [--benchmark_filter=<substring>] "
+      "[--benchmark_min_time=<seconds>] [--benchmark_out=<json file>]\n",
+      program);
+  exit(1);
+}
+
+}  // namespace
+
+int
+main(int argc, char** argv)
+{
+  std::string filter;
+  std::string out_path;
+  double min_time_s = 0.5;
+  for (int i = 1; i < argc; ++i) {
+    const std::string arg = argv[i];
+    const size_t eq = arg.find('=');
+    const std::string flag = arg.substr(0, eq);
+    const std::string value =
+        (eq == std::string::npos) ? std::string() : arg.substr(eq + 1);
+    if (flag == "--benchmark_filter") {
+      filter = value;
+    } else if (flag == "--benchmark_min_time") {
+      min_time_s = atof(value.c_str());
+      if (min_time_s <= 0) {
+        Usage(argv[0]);
+      }
+    } else if (flag == "--benchmark_out") {
+      out_path = value;
+    } else {
+      Usage(argv[0]);
+    }
+  }
+
+  std::vector<Benchmark> benchmarks;
+  RegisterRequestLifecycle(&benchmarks);
+  RegisterRequestReuse(&benchmarks);
+  RegisterInferAsyncRoundTrip(&benchmarks);
+  RegisterInferAsyncBatch(&benchmarks);
+  RegisterResponseOutputIteration(&benchmarks);
+  RegisterBackendInputBuffer(&benchmarks);
+  RegisterBackendOutputBuffer(&benchmarks);
+  RegisterResponseSendBatch(&benchmarks);
+  RegisterStatistics(&benchmarks);
+
+  Environment* env = CreateEnvironment();
+
+  printf(
+      "%-48s %15s %15s %12s\n", "Benchmark", "Time", "CPU", "Iterations");
+  std::vector<Result> results;
+  for (const auto& benchmark : benchmarks) {
+    if (!filter.empty() &&
+        (RunName(benchmark).find(filter) == std::string::npos)) {
+      continue;
+    }
+    Result result = Run(env, benchmark, min_time_s);
+    PrintResult(result);
+    results.push_back(result);
+  }
+
+  DeleteEnvironment(env);
+
+  if (!out_path.empty() && !WriteJson(out_path, results)) {
+    fprintf(stderr, "error: failed to write '%s'\n", out_path.c_str());
+    return 1;
+  }
+
+  return 0;
+}
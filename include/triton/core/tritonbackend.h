@@ -58,11 +58,13 @@ struct TRITONBACKEND_MemoryManager;
 struct TRITONBACKEND_Input;
 struct TRITONBACKEND_Output;
 struct TRITONBACKEND_Request;
+struct TRITONBACKEND_State;
 struct TRITONBACKEND_ResponseFactory;
 struct TRITONBACKEND_Response;
 struct TRITONBACKEND_Backend;
 struct TRITONBACKEND_Model;
 struct TRITONBACKEND_ModelInstance;
+struct TRITONBACKEND_Execution;
 
 ///
 /// TRITONBACKEND API Version
@@ -90,7 +92,7 @@ struct TRITONBACKEND_ModelInstance;
 ///   }
 ///
 #define TRITONBACKEND_API_VERSION_MAJOR 1
-#define TRITONBACKEND_API_VERSION_MINOR 6
+#define TRITONBACKEND_API_VERSION_MINOR 19
 
 /// Get the TRITONBACKEND API version supported by Triton. This value
 /// can be compared against the TRITONBACKEND_API_VERSION_MAJOR and
@@ -115,8 +117,18 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ApiVersion(
 ///     accessible filesystem. The backend can access these files
 ///     using an appropriate system API.
 ///
+///   TRITONBACKEND_ARTIFACT_MEMORY: The model artifacts are made
+///     available as buffers in the memory of the Triton process, \see
+///     TRITONBACKEND_ModelArtifact.
+///
+///   TRITONBACKEND_ARTIFACT_FILE_DESCRIPTOR: The model artifacts are
+///     made available as open file descriptors that can be mapped into
+///     memory, \see TRITONBACKEND_ModelArtifact.
+///
 typedef enum TRITONBACKEND_artifacttype_enum {
-  TRITONBACKEND_ARTIFACT_FILESYSTEM
+  TRITONBACKEND_ARTIFACT_FILESYSTEM,
+  TRITONBACKEND_ARTIFACT_MEMORY,
+  TRITONBACKEND_ARTIFACT_FILE_DESCRIPTOR
 } TRITONBACKEND_ArtifactType;
 
 
@@ -172,6 +184,46 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_MemoryManagerFree(
     TRITONBACKEND_MemoryManager* manager, void* buffer,
     const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id);
 
+/// Allocate a contiguous block of GPU memory, ordered on a CUDA
+/// stream, using a memory manager. The memory is available for use by
+/// work enqueued on 'cuda_stream' after the call returns, and by work
+/// on other streams only once they are synchronized with
+/// 'cuda_stream'. Memory freed with TRITONBACKEND_MemoryManagerFreeAsync
+/// on the same stream can be reused without synchronizing with the
+/// device. The same error codes as for
+/// TRITONBACKEND_MemoryManagerAllocate are returned.
+///
+/// \param manager The memory manager.
+/// \param buffer Returns the allocated memory.
+/// \param memory_type_id The device ID of the GPU to allocate from.
+/// \param byte_size The size of memory to allocate, in bytes.
+/// \param cuda_stream The cudaStream_t, cast to void*, that orders the
+/// allocation.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_MemoryManagerAllocateAsync(
+    TRITONBACKEND_MemoryManager* manager, void** buffer,
+    const int64_t memory_type_id, const uint64_t byte_size,
+    void* cuda_stream);
+
+/// Free a buffer that was previously allocated with
+/// TRITONBACKEND_MemoryManagerAllocateAsync, ordered on a CUDA
+/// stream. The memory is returned to the pool once the work enqueued
+/// on 'cuda_stream' before the call has completed, so the caller does
+/// not need to synchronize the stream before freeing a buffer that is
+/// still in use by that work.
+///
+/// \param manager The memory manager.
+/// \param buffer The allocated memory buffer to free.
+/// \param memory_type_id The device ID of the GPU of the buffer.
+/// \param cuda_stream The cudaStream_t, cast to void*, that orders the
+/// free.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_MemoryManagerFreeAsync(
+    TRITONBACKEND_MemoryManager* manager, void* buffer,
+    const int64_t memory_type_id, void* cuda_stream);
+
 ///
 /// TRITONBACKEND_Input
 ///
@@ -260,6 +312,42 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_InputBuffer(
     uint64_t* buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
     int64_t* memory_type_id);
 
+/// Get a buffer holding (part of) the tensor data for an input without
+/// waiting for any copy that is needed to provide the buffer in the
+/// preferred memory type. This is the same as TRITONBACKEND_InputBuffer
+/// except that a copy performed to satisfy the preferred memory type
+/// is only enqueued on 'cuda_stream' and may still be in progress when
+/// the function returns. Input staging for a batch can therefore
+/// overlap with computation already enqueued on the stream, typically
+/// the stream returned by TRITONBACKEND_ModelInstanceCudaStream.
+///
+/// \param input The input tensor.
+/// \param index The index of the buffer. Must be 0 <= index <
+/// buffer_count, where buffer_count is the value returned by
+/// TRITONBACKEND_InputProperties.
+/// \param buffer Returns a pointer to a contiguous block of data for
+/// the named input.
+/// \param buffer_byte_size Returns the size, in bytes, of 'buffer'.
+/// \param memory_type Acts as both input and output. On input gives
+/// the buffer memory type preferred by the function caller.  Returns
+/// the actual memory type of 'buffer'.
+/// \param memory_type_id Acts as both input and output. On input
+/// gives the buffer memory type id preferred by the function caller.
+/// Returns the actual memory type id of 'buffer'.
+/// \param cuda_stream The cudaStream_t, cast to void*, on which any
+/// copy is enqueued.
+/// \param cuda_event Returns the cudaEvent_t, cast to void*, that is
+/// recorded on 'cuda_stream' after the copy, or nullptr if no copy was
+/// needed and 'buffer' may be accessed immediately. The event is owned
+/// by the input and must not be destroyed by the caller. The caller
+/// must wait for the event, or order its work after the event on
+/// another stream, before accessing 'buffer'.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_InputBufferAsync(
+    TRITONBACKEND_Input* input, const uint32_t index, const void** buffer,
+    uint64_t* buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
+    int64_t* memory_type_id, void* cuda_stream, void** cuda_event);
+
 /// Get a buffer holding (part of) the tensor data for an input for a specific
 /// host policy. If there are no input buffers specified for this host policy,
 /// the fallback input buffer is returned.
@@ -268,7 +356,10 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_InputBuffer(
 /// The returned buffer is owned by the input and so should not be modified or
 /// freed by the caller. The lifetime of the buffer matches that of the input
 /// and so the buffer should not be accessed after the input tensor object is
-/// released.
+/// released. If the buffer must be copied to provide it in
+/// TRITONSERVER_MEMORY_CPU_PINNED memory and the host policy sets
+/// "numa-node", the copy is staged in the pinned memory pool of that
+/// NUMA node, \see TRITONSERVER_ServerOptionsSetHostPolicy.
 ///
 /// \param input The input tensor.
 /// \param host_policy_name The host policy name. Fallback input buffer
@@ -292,6 +383,71 @@ TRITONBACKEND_InputBufferForHostPolicy(
     const uint32_t index, const void** buffer, uint64_t* buffer_byte_size,
     TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id);
 
+/// Get a buffer holding (part of) the tensor data for an input for a
+/// specific host policy without waiting for any copy that is needed to
+/// provide the buffer in the preferred memory type. This is the same
+/// as TRITONBACKEND_InputBufferForHostPolicy except that the copy is
+/// only enqueued on 'cuda_stream', as described for
+/// TRITONBACKEND_InputBufferAsync.
+///
+/// \param input The input tensor.
+/// \param host_policy_name The host policy name. Fallback input buffer
+/// will be return if nullptr is provided.
+/// \param index The index of the buffer. Must be 0 <= index <
+/// buffer_count, where buffer_count is the value returned by
+/// TRITONBACKEND_InputPropertiesForHostPolicy.
+/// \param buffer Returns a pointer to a contiguous block of data for
+/// the named input.
+/// \param buffer_byte_size Returns the size, in bytes, of 'buffer'.
+/// \param memory_type Acts as both input and output. On input gives
+/// the buffer memory type preferred by the function caller.  Returns
+/// the actual memory type of 'buffer'.
+/// \param memory_type_id Acts as both input and output. On input
+/// gives the buffer memory type id preferred by the function caller.
+/// Returns the actual memory type id of 'buffer'.
+/// \param cuda_stream The cudaStream_t, cast to void*, on which any
+/// copy is enqueued.
+/// \param cuda_event Returns the cudaEvent_t, cast to void*, that is
+/// recorded on 'cuda_stream' after the copy, or nullptr if no copy was
+/// needed. \see TRITONBACKEND_InputBufferAsync.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_InputBufferForHostPolicyAsync(
+    TRITONBACKEND_Input* input, const char* host_policy_name,
+    const uint32_t index, const void** buffer, uint64_t* buffer_byte_size,
+    TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id,
+    void* cuda_stream, void** cuda_event);
+
+/// Get the layout in which the client provided the data of a BYTES
+/// input. Reading the input in this layout, by selecting it with
+/// TRITONBACKEND_InputSetBytesLayout, does not require Triton to
+/// convert the data.
+///
+/// \param input The input tensor. Must have datatype
+/// TRITONSERVER_TYPE_BYTES.
+/// \param layout Returns the layout of the data provided by the
+/// client.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_InputBytesLayout(
+    TRITONBACKEND_Input* input, TRITONSERVER_BytesLayout* layout);
+
+/// Select the layout in which the buffers returned for a BYTES input
+/// by TRITONBACKEND_InputBuffer and its variants hold the data. The
+/// default is TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED, so backends
+/// that do not select a layout are unaffected by the layout used by
+/// the client. If the client provided the data in a different layout,
+/// Triton converts it into a single buffer, and the byte size and
+/// buffer count returned by TRITONBACKEND_InputProperties describe
+/// the converted data. Must be called before the input buffers are
+/// accessed.
+///
+/// \param input The input tensor. Must have datatype
+/// TRITONSERVER_TYPE_BYTES.
+/// \param layout The layout to read the data in.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_InputSetBytesLayout(
+    TRITONBACKEND_Input* input, const TRITONSERVER_BytesLayout layout);
+
 ///
 /// TRITONBACKEND_Output
 ///
@@ -321,6 +477,47 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_OutputBuffer(
     const uint64_t buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
     int64_t* memory_type_id);
 
+/// Get a buffer to use to hold the tensor data for the output, where
+/// the buffer will be filled by work enqueued on a CUDA stream. This is
+/// the same as TRITONBACKEND_OutputBuffer except that the output is
+/// associated with 'cuda_stream'. When the response holding the output
+/// is sent with TRITONBACKEND_ResponseSend, Triton records an event on
+/// 'cuda_stream' and delivers the response only once that event has
+/// completed, so the backend does not need to synchronize the stream
+/// before sending the response.
+///
+/// \param buffer Returns a pointer to a buffer where the contents of
+/// the output tensor should be placed.
+/// \param buffer_byte_size The size, in bytes, of the buffer required
+/// by the caller.
+/// \param memory_type Acts as both input and output. On input gives
+/// the buffer memory type preferred by the caller.  Returns the
+/// actual memory type of 'buffer'.
+/// \param memory_type_id Acts as both input and output. On input
+/// gives the buffer memory type id preferred by the caller. Returns
+/// the actual memory type id of 'buffer'.
+/// \param cuda_stream The cudaStream_t, cast to void*, on which the
+/// work that fills 'buffer' is enqueued.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_OutputBufferAsync(
+    TRITONBACKEND_Output* output, void** buffer,
+    const uint64_t buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
+    int64_t* memory_type_id, void* cuda_stream);
+
+/// Get the layout in which the data of a BYTES output must be written
+/// to the output buffer. This is the layout requested by the client
+/// with TRITONSERVER_InferenceRequestSetRequestedOutputBytesLayout,
+/// TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED by default. A backend
+/// that produces the data in another layout can convert it with
+/// TRITONSERVER_BytesLayoutConvert.
+///
+/// \param output The output tensor. Must have datatype
+/// TRITONSERVER_TYPE_BYTES.
+/// \param layout Returns the layout of the output data.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_OutputBytesLayout(
+    TRITONBACKEND_Output* output, TRITONSERVER_BytesLayout* layout);
+
 ///
 /// TRITONBACKEND_Request
 ///
@@ -396,7 +593,9 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_RequestInput(
 /// request is not necessarily consistent with other requests, even if
 /// the requests are in the same batch. As a result, you can not
 /// assume that an index obtained from one request will point to the
-/// same input in a different request.
+/// same input in a different request. Use
+/// TRITONBACKEND_RequestInputBySlot to access inputs by a position
+/// that is consistent across requests.
 ///
 /// The lifetime of the returned input object matches that of the
 /// request and so the input object should not be accessed after the
@@ -412,6 +611,24 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_RequestInputByIndex(
     TRITONBACKEND_Request* request, const uint32_t index,
     TRITONBACKEND_Input** input);
 
+/// Get a request input by slot. The slot of an input is resolved
+/// once for the model with TRITONBACKEND_ModelInputSlot. Triton
+/// orders the inputs of each request by slot when the request is
+/// enqueued, so this lookup does not compare input names. The
+/// lifetime of the returned input object matches that of the request
+/// and so the input object should not be accessed after the request
+/// object is released.
+///
+/// \param request The inference request.
+/// \param slot The slot of the input.
+/// \param input Returns the input corresponding to the slot, or
+/// nullptr if the request does not have the input, for example
+/// because the input is optional.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_RequestInputBySlot(
+    TRITONBACKEND_Request* request, const uint32_t slot,
+    TRITONBACKEND_Input** input);
+
 /// Get the number of output tensors requested to be returned in the
 /// request.
 ///
@@ -436,6 +653,19 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_RequestOutputName(
     TRITONBACKEND_Request* request, const uint32_t index,
     const char** output_name);
 
+/// Get whether an output is requested to be returned in the
+/// request. The slot of an output is resolved once for the model with
+/// TRITONBACKEND_ModelOutputSlot.
+///
+/// \param request The inference request.
+/// \param slot The slot of the output.
+/// \param requested Returns true if the output is requested, false if
+/// not.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestOutputRequestedBySlot(
+    TRITONBACKEND_Request* request, const uint32_t slot, bool* requested);
+
 /// Release the request. The request should be released when it is no
 /// longer needed by the backend. If this call returns with an error
 /// (i.e. non-nullptr) then the request was not released and ownership
@@ -454,6 +684,161 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_RequestOutputName(
 TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_RequestRelease(
     TRITONBACKEND_Request* request, uint32_t release_flags);
 
+/// Gather the tensor data of a named input from a batch of requests
+/// into a single contiguous buffer. This is equivalent to using
+/// TRITONBACKEND_RequestInput, TRITONBACKEND_InputProperties and
+/// TRITONBACKEND_InputBuffer to visit every buffer of the input in
+/// every request, and copying each buffer into 'buffer', except that
+/// the copies are coalesced. Adjacent source buffers are copied with
+/// a single operation, copies into GPU memory are issued together as
+/// asynchronous copies on 'cuda_stream', and large copies into CPU
+/// memory are divided among the buffer manager threads (\see
+/// TRITONSERVER_ServerOptionsSetBufferManagerThreadCount).
+///
+/// The data of each request is placed in 'buffer' in the order of the
+/// requests in 'requests', with no padding between requests. Every
+/// request must contain the input, otherwise
+/// TRITONSERVER_ERROR_INVALID_ARG is returned. If the combined size of
+/// the input data exceeds 'buffer_byte_size' then
+/// TRITONSERVER_ERROR_INVALID_ARG is returned and no data is copied.
+///
+/// If 'contiguous_buffer' is non-nullptr and the input data of all the
+/// requests already resides, in request order, in a single contiguous
+/// block of memory of the requested memory type and memory type ID
+/// (for example, because the requests were created from consecutive
+/// ranges of one registered memory region), then the batch can be
+/// served without copying. In that case no data is copied into
+/// 'buffer' and 'contiguous_buffer' returns the base address of that
+/// block, which is owned by the requests and must not be accessed
+/// after any of the requests are released. Otherwise
+/// 'contiguous_buffer' returns nullptr and the data is gathered into
+/// 'buffer'.
+///
+/// \param requests The requests, typically the 'requests' array given
+/// to TRITONBACKEND_ModelInstanceExecute.
+/// \param request_count The number of requests in 'requests'.
+/// \param name The name of the input.
+/// \param host_policy_name The host policy name used to select the
+/// input buffers, as in TRITONBACKEND_InputBufferForHostPolicy. The
+/// fallback input buffers are used if nullptr is provided.
+/// \param buffer The destination buffer.
+/// \param buffer_byte_size The size, in bytes, of 'buffer'.
+/// \param memory_type The memory type of 'buffer'.
+/// \param memory_type_id The memory type id of 'buffer'.
+/// \param cuda_stream The cudaStream_t, cast to void*, on which
+/// asynchronous copies are issued. If nullptr then all copies are
+/// complete when the function returns.
+/// \param request_byte_offsets If non-nullptr, must hold
+/// 'request_count' entries and returns the offset, in bytes, of the
+/// data of each request within the gathered batch.
+/// \param contiguous_buffer If non-nullptr, returns the base address
+/// of the input data if the batch can be served without copying, as
+/// described above, or nullptr otherwise.
+/// \param cuda_copy Returns true if asynchronous copies were issued on
+/// 'cuda_stream', in which case the caller must synchronize the stream
+/// before accessing 'buffer'. Returns false if the contents of
+/// 'buffer' are complete when the function returns.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_RequestsGatherInput(
+    TRITONBACKEND_Request** requests, const uint32_t request_count,
+    const char* name, const char* host_policy_name, void* buffer,
+    const uint64_t buffer_byte_size, const TRITONSERVER_MemoryType memory_type,
+    const int64_t memory_type_id, void* cuda_stream,
+    uint64_t* request_byte_offsets, const void** contiguous_buffer,
+    bool* cuda_copy);
+
+///
+/// TRITONBACKEND_State
+///
+/// Object representing a new value of a named state tensor of a
+/// sequence. Triton stores the states of each sequence, identified by
+/// the correlation ID of its requests (\see
+/// TRITONSERVER_InferenceRequestSetCorrelationId), so that a stateful
+/// model does not need to send its state to and from the client as
+/// input and output tensors, or keep its own map from correlation ID
+/// to state. The value of a state stays in the memory it was written
+/// to across the requests of the sequence. The states of a sequence
+/// are released when a request flagged with
+/// TRITONSERVER_REQUEST_FLAG_SEQUENCE_END is released or when the
+/// sequence is timed out by the sequence batcher. The GPU state of a
+/// sequence that is idle for longer than the spill timeout is moved
+/// to pinned host memory, and is moved back to its GPU when the next
+/// request of the sequence is executed, \see
+/// TRITONSERVER_ServerOptionsSetSequenceStateSpillTimeout.
+///
+
+/// Get the current value of a named state of the sequence of a
+/// request. The value is returned as an input tensor, whose
+/// properties and data are read with TRITONBACKEND_InputProperties
+/// and TRITONBACKEND_InputBuffer. The returned input is owned by the
+/// request and must not be accessed after the request is released.
+/// Returns TRITONSERVER_ERROR_NOT_FOUND if the sequence does not have
+/// a value for the state, for example for the first request of the
+/// sequence, and TRITONSERVER_ERROR_INVALID_ARG if the request does
+/// not have a correlation ID.
+///
+/// \param request The inference request.
+/// \param name The name of the state.
+/// \param state Returns the current value of the state.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_RequestState(
+    TRITONBACKEND_Request* request, const char* name,
+    TRITONBACKEND_Input** state);
+
+/// Create a new value of a named state of the sequence of a
+/// request. The new value does not replace the current value of the
+/// state until TRITONBACKEND_StateUpdate is called. A state that is
+/// not updated is released with the request, and the current value
+/// of the state is unchanged.
+///
+/// \param state Returns the new state.
+/// \param request The inference request.
+/// \param name The name of the state.
+/// \param datatype The datatype of the state.
+/// \param shape The shape of the state.
+/// \param dims_count The number of dimensions in 'shape'.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_StateNew(
+    TRITONBACKEND_State** state, TRITONBACKEND_Request* request,
+    const char* name, const TRITONSERVER_DataType datatype,
+    const int64_t* shape, const uint32_t dims_count);
+
+/// Get a buffer to hold the data of a new state value. The buffer is
+/// allocated by Triton and is owned by the state, so it should not be
+/// freed by the caller. Because the current value of the state is
+/// kept until TRITONBACKEND_StateUpdate, the caller can read the
+/// current value while writing the new one.
+///
+/// \param state The state.
+/// \param buffer Returns a pointer to a buffer where the contents of
+/// the state should be placed.
+/// \param buffer_byte_size The size, in bytes, of the buffer required
+/// by the caller.
+/// \param memory_type Acts as both input and output. On input gives
+/// the buffer memory type preferred by the caller. Returns the
+/// actual memory type of 'buffer'.
+/// \param memory_type_id Acts as both input and output. On input
+/// gives the buffer memory type id preferred by the caller. Returns
+/// the actual memory type id of 'buffer'.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_StateBuffer(
+    TRITONBACKEND_State* state, void** buffer,
+    const uint64_t buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
+    int64_t* memory_type_id);
+
+/// Make a new state value the current value of the state, releasing
+/// the previous value. The new value is returned by
+/// TRITONBACKEND_RequestState for the following requests of the
+/// sequence. Calling this function transfers ownership of the state
+/// object to Triton, the caller must not access the state object
+/// after calling this function. Must be called before the request the
+/// state was created for is released.
+///
+/// \param state The state.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_StateUpdate(
+    TRITONBACKEND_State* state);
+
 ///
 /// TRITONBACKEND_ResponseFactory
 ///
@@ -591,6 +976,82 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ResponseOutput(
     const char* name, const TRITONSERVER_DataType datatype,
     const int64_t* shape, const uint32_t dims_count);
 
+/// Create an output tensor in the response, identified by the slot
+/// of the output. This is equivalent to TRITONBACKEND_ResponseOutput
+/// for the output with the name that resolves to 'slot' with
+/// TRITONBACKEND_ModelOutputSlot, but does not look up the name.
+///
+/// \param response The response.
+/// \param output Returns the new response output.
+/// \param slot The slot of the output tensor.
+/// \param datatype The datatype of the output tensor.
+/// \param shape The shape of the output tensor.
+/// \param dims_count The number of dimensions in the output tensor
+/// shape.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ResponseOutputBySlot(
+    TRITONBACKEND_Response* response, TRITONBACKEND_Output** output,
+    const uint32_t slot, const TRITONSERVER_DataType datatype,
+    const int64_t* shape, const uint32_t dims_count);
+
+/// Create a named output tensor in each of a batch of responses and
+/// fill each output from consecutive slices of a single buffer that
+/// holds the output for the entire batch. This is equivalent to
+/// calling TRITONBACKEND_ResponseOutput and TRITONBACKEND_OutputBuffer
+/// for each response and copying the corresponding slice into the
+/// returned buffer, except that the copies are coalesced. Output
+/// buffers are allocated with the response allocator of each request
+/// as usual, and copies that involve GPU memory are issued together
+/// as asynchronous copies on 'cuda_stream'. When 'buffer' is in GPU
+/// memory and many of the output buffers are in CPU memory, Triton
+/// may instead transfer the entire batch to CPU memory with a single
+/// device-to-host copy and split it on the host, whenever that is
+/// cheaper than issuing a separate copy for each response.
+///
+/// The output of response i is 'shapes[i * dims_count]' through
+/// 'shapes[(i + 1) * dims_count - 1]' and its data is the slice of
+/// 'buffer' that immediately follows the data of response i - 1. An
+/// entry in 'responses' may be nullptr, in which case no output is
+/// created for that entry but its slice of 'buffer' is still skipped.
+/// 'datatype' must not be TRITONSERVER_TYPE_BYTES, and the combined
+/// size of the slices must not exceed 'buffer_byte_size', otherwise
+/// TRITONSERVER_ERROR_INVALID_ARG is returned and no output is
+/// created. If an error is returned after some outputs were created
+/// the state of those outputs is undefined and the responses should
+/// be sent with an error.
+///
+/// The same rules as TRITONBACKEND_ResponseOutput apply to each
+/// response: all outputs of a response must be created before another
+/// response is created for the same request.
+///
+/// \param responses The responses.
+/// \param response_count The number of responses in 'responses'.
+/// \param name The name of the output tensor.
+/// \param datatype The datatype of the output tensor.
+/// \param shapes The shape of the output tensor for each response,
+/// 'response_count' * 'dims_count' values in total.
+/// \param dims_count The number of dimensions in each output tensor
+/// shape.
+/// \param buffer The buffer holding the output for the whole batch.
+/// \param buffer_byte_size The size, in bytes, of 'buffer'.
+/// \param memory_type The memory type of 'buffer'.
+/// \param memory_type_id The memory type id of 'buffer'.
+/// \param cuda_stream The cudaStream_t, cast to void*, on which
+/// asynchronous copies are issued. If nullptr then all copies are
+/// complete when the function returns.
+/// \param cuda_copy Returns true if asynchronous copies were issued on
+/// 'cuda_stream', in which case the caller must synchronize the stream
+/// before sending the responses. Returns false if all output data is
+/// complete when the function returns.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponsesScatterOutput(
+    TRITONBACKEND_Response** responses, const uint32_t response_count,
+    const char* name, const TRITONSERVER_DataType datatype,
+    const int64_t* shapes, const uint32_t dims_count, const void* buffer,
+    const uint64_t buffer_byte_size, const TRITONSERVER_MemoryType memory_type,
+    const int64_t memory_type_id, void* cuda_stream, bool* cuda_copy);
+
 /// Send a response. Calling this function transfers ownership of the
 /// response object to Triton. The caller must not access or delete
 /// the response object after calling this function.
@@ -606,6 +1067,33 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ResponseSend(
     TRITONBACKEND_Response* response, const uint32_t send_flags,
     TRITONSERVER_Error* error);
 
+/// Send a batch of responses in one call. The responses may belong
+/// to different requests and may have been created from different
+/// response factories. This is equivalent to calling
+/// TRITONBACKEND_ResponseSend for each response in order, except
+/// that the responses for all requests that set the same batch
+/// response callback with
+/// TRITONSERVER_InferenceRequestSetResponseBatchCallback are
+/// delivered to the front-end in a single call of that callback.
+/// Calling this function transfers ownership of every response object
+/// to Triton, even if an error is returned. The caller must not
+/// access or delete any of the response objects after calling this
+/// function.
+///
+/// \param responses The responses.
+/// \param response_count The number of responses in 'responses'.
+/// \param send_flags The flags associated with each response, entry
+/// i holds the flags of 'responses[i]'. \see
+/// TRITONSERVER_ResponseCompleteFlag. \see
+/// TRITONSERVER_InferenceResponseCompleteFn_t.
+/// \param errors The TRITONSERVER_Error to send for each response,
+/// entry i is the error of 'responses[i]' or nullptr if that response
+/// is successful. May be nullptr if all responses are successful.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ResponseSendBatch(
+    TRITONBACKEND_Response** responses, const uint32_t response_count,
+    const uint32_t* send_flags, TRITONSERVER_Error** errors);
+
 ///
 /// TRITONBACKEND_Backend
 ///
@@ -642,9 +1130,24 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ResponseSend(
 ///     typically used by a backend that can cooperatively execute
 ///     multiple model instances on the same device.
 ///
+///   TRITONBACKEND_EXECUTION_ASYNC: An instance of the model may
+///     return from TRITONBACKEND_ModelInstanceExecute as soon as the
+///     work for the batch has been enqueued (for example, on a CUDA
+///     stream), without waiting for that work to finish. Before
+///     returning, the backend obtains the execution's handle with
+///     TRITONBACKEND_ModelInstanceExecution and later signals that the
+///     execution has finished with TRITONBACKEND_ExecutionComplete or
+///     TRITONBACKEND_ExecutionCompleteOnEvent. Triton may call
+///     TRITONBACKEND_ModelInstanceExecute for the same instance again
+///     while earlier executions are still in progress, up to the
+///     execution depth of the instance (\see
+///     TRITONBACKEND_ModelInstanceSetExecutionDepth), so that several
+///     batches can be in flight on an instance at once.
+///
 typedef enum TRITONBACKEND_execpolicy_enum {
   TRITONBACKEND_EXECUTION_BLOCKING,
-  TRITONBACKEND_EXECUTION_DEVICE_BLOCKING
+  TRITONBACKEND_EXECUTION_DEVICE_BLOCKING,
+  TRITONBACKEND_EXECUTION_ASYNC
 } TRITONBACKEND_ExecutionPolicy;
 
 /// Get the name of the backend. The caller does not own the returned
@@ -778,6 +1281,15 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelVersion(
 ///     owned by Triton, not the caller, and so should not be modified
 ///     or freed.
 ///
+///   TRITONBACKEND_ARTIFACT_MEMORY,
+///   TRITONBACKEND_ARTIFACT_FILE_DESCRIPTOR: The model artifacts have
+///     been provided by a repository agent and are retrieved with
+///     TRITONBACKEND_ModelArtifactCount and
+///     TRITONBACKEND_ModelArtifact. 'location' returns the full path to
+///     the directory in the model repository that holds the model
+///     configuration. These artifact types are only reported to
+///     backends built against TRITONBACKEND API version 1.14 or later.
+///
 /// \param model The model.
 /// \param artifact_type Returns the artifact type for the model.
 /// \param path Returns the location.
@@ -786,6 +1298,40 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelRepository(
     TRITONBACKEND_Model* model, TRITONBACKEND_ArtifactType* artifact_type,
     const char** location);
 
+/// Get the number of model artifacts provided by a repository agent
+/// as TRITONBACKEND_ARTIFACT_MEMORY or
+/// TRITONBACKEND_ARTIFACT_FILE_DESCRIPTOR artifacts. Returns 0 for any
+/// other artifact type.
+///
+/// \param model The model.
+/// \param count Returns the number of artifacts.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelArtifactCount(
+    TRITONBACKEND_Model* model, uint32_t* count);
+
+/// Get a model artifact provided by a repository agent. The returned
+/// name, buffer and file descriptor are owned by Triton and remain
+/// valid for the lifetime of the model. The backend must not modify
+/// the buffer or close the file descriptor, but may map the file
+/// descriptor into memory, for example with mmap, as long as the
+/// mapping is removed in TRITONBACKEND_ModelFinalize.
+///
+/// \param model The model.
+/// \param index The index of the artifact. Must be 0 <= index < count,
+/// where count is the value returned by
+/// TRITONBACKEND_ModelArtifactCount.
+/// \param name Returns the name of the artifact, as a path relative to
+/// the model directory, for example "1/model.plan".
+/// \param base Returns the base address of the artifact for a
+/// TRITONBACKEND_ARTIFACT_MEMORY artifact, or nullptr otherwise.
+/// \param fd Returns the file descriptor of the artifact for a
+/// TRITONBACKEND_ARTIFACT_FILE_DESCRIPTOR artifact, or -1 otherwise.
+/// \param byte_size Returns the size of the artifact, in bytes.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelArtifact(
+    TRITONBACKEND_Model* model, const uint32_t index, const char** name,
+    const void** base, int* fd, size_t* byte_size);
+
 /// Get the model configuration. The caller takes ownership of the
 /// message object and must call TRITONSERVER_MessageDelete to release
 /// the object. The configuration is available via this call even
@@ -805,6 +1351,20 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelConfig(
     TRITONBACKEND_Model* model, const uint32_t config_version,
     TRITONSERVER_Message** model_config);
 
+/// Get the configuration of the model as a read-only
+/// TRITONSERVER_ModelConfigView, so that the configuration can be
+/// inspected without parsing a message. The view is owned by the model
+/// and must not be released. The view remains valid for the lifetime
+/// of the model, except that after a call to
+/// TRITONBACKEND_ModelSetConfig the view must be retrieved again to
+/// reflect the updated configuration.
+///
+/// \param model The model.
+/// \param view Returns the model configuration view.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelConfigView(
+    TRITONBACKEND_Model* model, TRITONSERVER_ModelConfigView** view);
+
 /// Whether the backend should attempt to auto-complete the model configuration.
 /// If true, the model should fill the inputs, outputs, and max batch size in
 /// the model configuration if incomplete. If the model configuration is
@@ -837,6 +1397,33 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelSetConfig(
     TRITONBACKEND_Model* model, const uint32_t config_version,
     TRITONSERVER_Message* model_config);
 
+/// Get the slot of a model input. Slots are consecutive integers,
+/// starting at 0, in the order the inputs appear in the model
+/// configuration, and are stable for the lifetime of the model, so
+/// they can be resolved once in TRITONBACKEND_ModelInitialize and used
+/// with TRITONBACKEND_RequestInputBySlot for every request. If the
+/// configuration is changed with TRITONBACKEND_ModelSetConfig, slots
+/// must be resolved after the change.
+///
+/// \param model The model.
+/// \param name The name of the input.
+/// \param slot Returns the slot of the input.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelInputSlot(
+    TRITONBACKEND_Model* model, const char* name, uint32_t* slot);
+
+/// Get the slot of a model output. Slots are assigned and remain
+/// stable as described for TRITONBACKEND_ModelInputSlot, and can be
+/// used with TRITONBACKEND_RequestOutputRequestedBySlot and
+/// TRITONBACKEND_ResponseOutputBySlot.
+///
+/// \param model The model.
+/// \param name The name of the output.
+/// \param slot Returns the slot of the output.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelOutputSlot(
+    TRITONBACKEND_Model* model, const char* name, uint32_t* slot);
+
 /// Get the TRITONSERVER_Server object that this model is being served
 /// by.
 ///
@@ -906,6 +1493,22 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelInstanceKind(
 TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelInstanceDeviceId(
     TRITONBACKEND_ModelInstance* instance, int32_t* device_id);
 
+/// Get the CUDA stream that Triton created for the model
+/// instance. Triton uses this stream for the copies it performs on
+/// behalf of the instance, so a backend that enqueues its own work on
+/// the same stream is correctly ordered with respect to those copies
+/// without any explicit synchronization. The stream is owned by Triton
+/// and must not be destroyed by the backend. The lifetime of the
+/// stream extends only as long as 'instance'.
+///
+/// \param instance The model instance.
+/// \param stream Returns the cudaStream_t, cast to void*, for the
+/// instance, or nullptr if the instance is not a GPU instance.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceCudaStream(
+    TRITONBACKEND_ModelInstance* instance, void** stream);
+
 /// Get the host policy setting.  The 'host_policy' message is
 /// owned by Triton and should not be modified or freed by the caller.
 ///
@@ -933,6 +1536,19 @@ TRITONBACKEND_ModelInstanceHostPolicy(
 TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelInstanceIsPassive(
     TRITONBACKEND_ModelInstance* instance, bool* is_passive);
 
+/// Whether the model instance is currently active, that is, whether
+/// the scheduler sends requests to it. Non-passive instances are
+/// always active. A passive instance is active only while it is
+/// activated by load-driven activation, \see
+/// TRITONSERVER_ServerOptionsSetModelInstanceActivation.
+///
+/// \param instance The model instance.
+/// \param is_active Returns true if the instance is active, false
+/// otherwise.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelInstanceIsActive(
+    TRITONBACKEND_ModelInstance* instance, bool* is_active);
+
 /// Get the number of optimization profiles to be loaded for the instance.
 ///
 /// \param instance The model instance.
@@ -1011,6 +1627,116 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelInstanceState(
 TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelInstanceSetState(
     TRITONBACKEND_ModelInstance* instance, void* state);
 
+/// Set the execution depth of the model instance, which is the maximum
+/// number of executions that may be in progress on the instance at
+/// the same time when the backend uses the
+/// TRITONBACKEND_EXECUTION_ASYNC execution policy. The execution depth
+/// is ignored for other execution policies. The default depth is 2.
+/// This function can only be called from
+/// TRITONBACKEND_ModelInstanceInitialize, calling in any other context
+/// will result in an error being returned.
+///
+/// \param instance The model instance.
+/// \param depth The execution depth. Must be >= 1.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceSetExecutionDepth(
+    TRITONBACKEND_ModelInstance* instance, const uint32_t depth);
+
+/// Get the handle of the execution that is currently being performed
+/// by TRITONBACKEND_ModelInstanceExecute for the model instance. This
+/// function can only be called from within
+/// TRITONBACKEND_ModelInstanceExecute, on the thread that Triton used
+/// to invoke it, and only when the backend uses the
+/// TRITONBACKEND_EXECUTION_ASYNC execution policy. Calling in any other
+/// context will result in an error being returned.
+///
+/// \param instance The model instance.
+/// \param execution Returns the execution handle. The handle is owned
+/// by Triton and remains valid until the execution is completed.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceExecution(
+    TRITONBACKEND_ModelInstance* instance, TRITONBACKEND_Execution** execution);
+
+/// Allocate scratch memory from the arena of the model instance. Each
+/// model instance has an arena for each memory type and memory type
+/// ID that serves allocations by advancing an offset within blocks
+/// obtained from Triton's memory pools, so an allocation costs only a
+/// few instructions once the arena has grown to its working size. The
+/// memory cannot be freed individually. Instead all memory allocated
+/// from the instance's arenas during an execution is released when
+/// the execution ends, that is when TRITONBACKEND_ModelInstanceExecute
+/// returns or, for the TRITONBACKEND_EXECUTION_ASYNC execution policy,
+/// when the execution is completed. Arena memory must therefore not be
+/// used for output buffers or for any data that is accessed after the
+/// execution ends. This function can only be called from within
+/// TRITONBACKEND_ModelInstanceExecute or from work performed on behalf
+/// of an execution that has not yet completed.
+///
+/// The same error codes as for TRITONBACKEND_MemoryManagerAllocate are
+/// returned when the allocation cannot be satisfied.
+///
+/// \param instance The model instance.
+/// \param buffer Returns the allocated memory.
+/// \param memory_type The type of memory to allocate.
+/// \param memory_type_id The ID associated with the memory type to
+/// allocate. For GPU memory this indicates the device ID of the GPU
+/// to allocate from.
+/// \param byte_size The size of memory to allocate, in bytes.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceArenaAllocate(
+    TRITONBACKEND_ModelInstance* instance, void** buffer,
+    const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id,
+    const uint64_t byte_size);
+
+/// Allocate stream-ordered scratch GPU memory from the arena of the
+/// model instance. This is the same as
+/// TRITONBACKEND_ModelInstanceArenaAllocate except that the release of
+/// the memory at the end of the execution is ordered on 'cuda_stream':
+/// the memory is not reused for a later allocation until all work
+/// enqueued on 'cuda_stream' before the end of the execution has
+/// completed. The backend can therefore return from
+/// TRITONBACKEND_ModelInstanceExecute, or complete an asynchronous
+/// execution, while kernels using the memory are still running, and
+/// never needs to synchronize the stream to recycle scratch memory.
+/// The memory may be used only by work enqueued on 'cuda_stream', or
+/// by work on other streams that is ordered before it.
+///
+/// \param instance The model instance.
+/// \param buffer Returns the allocated memory.
+/// \param memory_type_id The ID of the GPU to allocate from.
+/// \param byte_size The size of memory to allocate, in bytes.
+/// \param cuda_stream The cudaStream_t, cast to void*, that orders use
+/// and release of the memory.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceArenaAllocateAsync(
+    TRITONBACKEND_ModelInstance* instance, void** buffer,
+    const int64_t memory_type_id, const uint64_t byte_size,
+    void* cuda_stream);
+
+/// Get the usage of the arena of the model instance for a memory type
+/// and memory type ID. The peak usage is the largest amount of arena
+/// memory allocated during any single execution and so indicates how
+/// much of the pinned and CUDA memory pools the instance requires,
+/// \see TRITONSERVER_ServerOptionsSetPinnedMemoryPoolByteSize and
+/// TRITONSERVER_ServerOptionsSetCudaMemoryPoolByteSize.
+///
+/// \param instance The model instance.
+/// \param memory_type The memory type of the arena.
+/// \param memory_type_id The memory type ID of the arena.
+/// \param reserved_byte_size Returns the size, in bytes, of the blocks
+/// currently held by the arena.
+/// \param peak_byte_size Returns the peak usage of the arena, in bytes.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceArenaUsage(
+    TRITONBACKEND_ModelInstance* instance,
+    const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id,
+    uint64_t* reserved_byte_size, uint64_t* peak_byte_size);
+
 /// Record statistics for an inference request.
 ///
 /// Set 'success' true to indicate that the inference request
@@ -1038,6 +1764,12 @@ TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ModelInstanceSetState(
 ///     CAPTURE TIMESPACE (exec_end_ns)
 ///     return
 ///
+/// When latency histograms are enabled (\see
+/// TRITONSERVER_ServerOptionsSetLatencyHistograms) these timestamps
+/// are also recorded into the latency histograms of the model and of
+/// 'instance'. Recording does not take any lock and so this function
+/// may be called concurrently from many threads without contention.
+///
 /// Note that these statistics are associated with a valid
 /// TRITONBACKEND_Request object and so must be reported before the
 /// request is released. For backends that release the request before
@@ -1095,6 +1827,46 @@ TRITONBACKEND_ModelInstanceReportBatchStatistics(
     const uint64_t exec_start_ns, const uint64_t compute_start_ns,
     const uint64_t compute_end_ns, const uint64_t exec_end_ns);
 
+///
+/// TRITONBACKEND_Execution
+///
+/// Object representing one call of TRITONBACKEND_ModelInstanceExecute
+/// made for a backend that uses the TRITONBACKEND_EXECUTION_ASYNC
+/// execution policy. Until an execution is completed it counts
+/// against the execution depth of its model instance. Completing an
+/// execution only indicates that the instance can accept more work;
+/// responses must still be sent and requests released as usual, and
+/// that may happen before or after the execution is completed.
+///
+
+/// Indicate that an execution has finished. The execution handle must
+/// not be accessed after this call. This function may be called from
+/// any thread, including from within
+/// TRITONBACKEND_ModelInstanceExecute, but must be called exactly once
+/// for each execution, either directly or through
+/// TRITONBACKEND_ExecutionCompleteOnEvent.
+///
+/// \param execution The execution.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error* TRITONBACKEND_ExecutionComplete(
+    TRITONBACKEND_Execution* execution);
+
+/// Indicate that an execution will have finished once a CUDA event
+/// completes. Triton waits for the event and then completes the
+/// execution as if by TRITONBACKEND_ExecutionComplete, so the backend
+/// does not need a thread of its own to wait for the device. The event
+/// must have been recorded before this call and must not be destroyed
+/// until the execution is completed. The execution handle must not be
+/// accessed after this call.
+///
+/// \param execution The execution.
+/// \param cuda_event The cudaEvent_t, cast to void*, that marks the end
+/// of the execution's work.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONBACKEND_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ExecutionCompleteOnEvent(
+    TRITONBACKEND_Execution* execution, void* cuda_event);
+
 
 ///
 /// The following functions can be implemented by a backend. Functions
@@ -1175,7 +1947,10 @@ TRITONBACKEND_ISPEC TRITONSERVER_Error* TRITONBACKEND_ModelInstanceFinalize(
 /// function is required. Triton will not perform multiple
 /// simultaneous calls to this function for a given model 'instance';
 /// however, there may be simultaneous calls for different model
-/// instances (for the same or different models).
+/// instances (for the same or different models). For a backend using
+/// the TRITONBACKEND_EXECUTION_ASYNC execution policy the calls for a
+/// given instance are still not simultaneous, but a call may be made
+/// before the executions started by earlier calls have completed.
 ///
 /// If an error is returned the ownership of the request objects
 /// remains with Triton and the backend must not retain references to
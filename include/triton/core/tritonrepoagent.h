@@ -83,7 +83,7 @@ struct TRITONREPOAGENT_AgentModel;
 ///   }
 ///
 #define TRITONREPOAGENT_API_VERSION_MAJOR 0
-#define TRITONREPOAGENT_API_VERSION_MINOR 1
+#define TRITONREPOAGENT_API_VERSION_MINOR 2
 
 /// Get the TRITONREPOAGENT API version supported by Triton. This
 /// value can be compared against the
@@ -114,9 +114,22 @@ TRITONREPOAGENT_DECLSPEC TRITONSERVER_Error* TRITONREPOAGENT_ApiVersion(
 ///     The remote filesystem path follows the same convention as is used for
 ///     repository paths, for example, "s3://" prefix indicates an S3 path.
 ///
+///   TRITONREPOAGENT_ARTIFACT_MEMORY: The model artifacts are
+///     communicated from the repository agent to Triton as buffers in
+///     the memory of the Triton process, \see
+///     TRITONREPOAGENT_ModelRepositoryUpdateMemory.
+///
+///   TRITONREPOAGENT_ARTIFACT_FILE_DESCRIPTOR: The model artifacts are
+///     communicated from the repository agent to Triton as open file
+///     descriptors that can be mapped into memory, for example
+///     descriptors created with memfd_create, \see
+///     TRITONREPOAGENT_ModelRepositoryUpdateFileDescriptor.
+///
 typedef enum TRITONREPOAGENT_artifacttype_enum {
   TRITONREPOAGENT_ARTIFACT_FILESYSTEM,
-  TRITONREPOAGENT_ARTIFACT_REMOTE_FILESYSTEM
+  TRITONREPOAGENT_ARTIFACT_REMOTE_FILESYSTEM,
+  TRITONREPOAGENT_ARTIFACT_MEMORY,
+  TRITONREPOAGENT_ARTIFACT_FILE_DESCRIPTOR
 } TRITONREPOAGENT_ArtifactType;
 
 /// TRITONREPOAGENT_ActionType
@@ -246,6 +259,12 @@ TRITONREPOAGENT_ModelRepositoryLocationRelease(
 ///     the agent should not modified or freed the contents until
 ///     TRITONREPOAGENT_ModelFinalize.
 ///
+/// TRITONREPOAGENT_ARTIFACT_MEMORY and
+/// TRITONREPOAGENT_ARTIFACT_FILE_DESCRIPTOR artifacts have no location
+/// and must instead be communicated with
+/// TRITONREPOAGENT_ModelRepositoryUpdateMemory and
+/// TRITONREPOAGENT_ModelRepositoryUpdateFileDescriptor.
+///
 /// \param agent The agent.
 /// \param model The model.
 /// \param artifact_type The artifact type for the location.
@@ -256,6 +275,61 @@ TRITONREPOAGENT_ModelRepositoryUpdate(
     TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
     const TRITONREPOAGENT_ArtifactType artifact_type, const char* location);
 
+/// Inform Triton that the specified in-memory artifacts should be used
+/// for the model in place of the original model repository. This
+/// allows an agent that decrypts, decompresses or downloads a model to
+/// pass the result to the backend without writing it to a
+/// filesystem. This method can only be called when
+/// TRITONREPOAGENT_ModelAction is invoked with
+/// TRITONREPOAGENT_ACTION_LOAD. The artifacts are made available to
+/// the backend as TRITONBACKEND_ARTIFACT_MEMORY artifacts, \see
+/// TRITONBACKEND_ModelArtifact. If the backend of the model does not
+/// support memory artifacts Triton writes the artifacts to a temporary
+/// local directory that is communicated to the backend as a
+/// TRITONBACKEND_ARTIFACT_FILESYSTEM location. The model configuration
+/// is still read from the original model repository.
+///
+/// The buffers are not copied and remain owned by the agent, which
+/// must not modify or free them until TRITONREPOAGENT_ModelFinalize.
+///
+/// \param agent The agent.
+/// \param model The model.
+/// \param names The name of each artifact, as a path relative to the
+/// model directory, for example "1/model.plan".
+/// \param bases The base address of each artifact.
+/// \param byte_sizes The size of each artifact, in bytes.
+/// \param artifact_count The number of artifacts.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONREPOAGENT_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelRepositoryUpdateMemory(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    const char** names, const void** bases, const size_t* byte_sizes,
+    const uint32_t artifact_count);
+
+/// Inform Triton that the specified file descriptors should be used
+/// for the model artifacts in place of the original model repository.
+/// The same conditions apply as for
+/// TRITONREPOAGENT_ModelRepositoryUpdateMemory except that the
+/// artifacts are made available to the backend as
+/// TRITONBACKEND_ARTIFACT_FILE_DESCRIPTOR artifacts. Each descriptor
+/// must support mmap. Ownership of the descriptors is transferred to
+/// Triton, which closes them when the model is unloaded, so the agent
+/// must not use or close them after a successful call.
+///
+/// \param agent The agent.
+/// \param model The model.
+/// \param names The name of each artifact, as a path relative to the
+/// model directory.
+/// \param fds The file descriptor of each artifact.
+/// \param byte_sizes The size of each artifact, in bytes.
+/// \param artifact_count The number of artifacts.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONREPOAGENT_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelRepositoryUpdateFileDescriptor(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    const char** names, const int* fds, const size_t* byte_sizes,
+    const uint32_t artifact_count);
+
 /// Get the number of agent parameters defined for a model.
 ///
 /// \param agent The agent.
@@ -55,6 +55,8 @@ struct TRITONSERVER_Error;
 struct TRITONSERVER_InferenceRequest;
 struct TRITONSERVER_InferenceResponse;
 struct TRITONSERVER_InferenceTrace;
+struct TRITONSERVER_MemoryRegion;
+struct TRITONSERVER_ModelConfigView;
 struct TRITONSERVER_Message;
 struct TRITONSERVER_Metrics;
 struct TRITONSERVER_ResponseAllocator;
@@ -87,7 +89,7 @@ struct TRITONSERVER_ServerOptions;
 ///   }
 ///
 #define TRITONSERVER_API_VERSION_MAJOR 1
-#define TRITONSERVER_API_VERSION_MINOR 5
+#define TRITONSERVER_API_VERSION_MINOR 26
 
 /// Get the TRITONBACKEND API version supported by the Triton shared
 /// library. This value can be compared against the
@@ -150,6 +152,66 @@ TRITONSERVER_StringToDataType(const char* dtype);
 TRITONSERVER_DECLSPEC uint32_t
 TRITONSERVER_DataTypeByteSize(TRITONSERVER_DataType datatype);
 
+/// TRITONSERVER_BytesLayout
+///
+/// Layouts of the data of a TRITONSERVER_TYPE_BYTES tensor with N
+/// elements. All integers are little-endian.
+///
+///   TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED: Each element is a
+///     4-byte length followed by the bytes of the element, and the
+///     elements follow each other in order. This is the default
+///     layout, and the layout used for all BYTES data by clients and
+///     backends that do not select a layout.
+///
+///   TRITONSERVER_BYTES_LAYOUT_OFFSETS: N + 1 8-byte offsets followed
+///     by the bytes of all the elements, contiguous and in order.
+///     Element i is the bytes from offset i to offset i + 1 of the
+///     element data that follows the offsets, so offset 0 is 0 and
+///     offset N is the size of the element data. Any element can be
+///     located without scanning the elements before it, and a range
+///     of elements can be sliced by rebasing its offsets.
+///
+typedef enum TRITONSERVER_byteslayout_enum {
+  TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED,
+  TRITONSERVER_BYTES_LAYOUT_OFFSETS
+} TRITONSERVER_BytesLayout;
+
+/// Get the string representation of a BYTES layout. The returned
+/// string is not owned by the caller and so should not be modified or
+/// freed.
+///
+/// \param layout The BYTES layout.
+/// \return The string representation of the BYTES layout.
+TRITONSERVER_DECLSPEC const char* TRITONSERVER_BytesLayoutString(
+    TRITONSERVER_BytesLayout layout);
+
+/// Convert the data of a BYTES tensor from one layout to another. The
+/// source data is validated, and TRITONSERVER_ERROR_INVALID_ARG is
+/// returned if it is not a well-formed encoding of 'element_count'
+/// elements in 'src_layout'. If 'dst' is nullptr no data is converted
+/// and 'converted_byte_size' returns the size of the converted data,
+/// so the caller can allocate 'dst'. Converting to the same layout
+/// validates and copies the data.
+///
+/// \param src_layout The layout of 'src'.
+/// \param src The data to convert.
+/// \param src_byte_size The size, in bytes, of 'src'.
+/// \param element_count The number of elements in 'src'.
+/// \param dst_layout The layout to convert to.
+/// \param dst The buffer that receives the converted data, or nullptr
+/// to only get the size of the converted data.
+/// \param dst_byte_size The size, in bytes, of 'dst'. If smaller than
+/// the size of the converted data TRITONSERVER_ERROR_INVALID_ARG is
+/// returned.
+/// \param converted_byte_size Returns the size, in bytes, of the
+/// converted data.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_BytesLayoutConvert(
+    const TRITONSERVER_BytesLayout src_layout, const void* src,
+    const size_t src_byte_size, const uint64_t element_count,
+    const TRITONSERVER_BytesLayout dst_layout, void* dst,
+    const size_t dst_byte_size, size_t* converted_byte_size);
+
 /// TRITONSERVER_MemoryType
 ///
 /// Types of memory recognized by TRITONSERVER.
@@ -219,14 +281,20 @@ typedef enum TRITONSERVER_loglevel_enum {
   TRITONSERVER_LOG_VERBOSE
 } TRITONSERVER_LogLevel;
 
-/// Is a log level enabled?
+/// Is a log level enabled? The check is a single relaxed atomic load
+/// and does not take a lock, so it can be used to skip the formatting
+/// of messages for disabled levels on performance-critical paths.
 ///
 /// \param level The log level.
 /// \return True if the log level is enabled, false if not enabled.
 TRITONSERVER_DECLSPEC bool TRITONSERVER_LogIsEnabled(
     TRITONSERVER_LogLevel level);
 
-/// Log a message at a given log level if that level is enabled.
+/// Log a message at a given log level if that level is enabled. If
+/// asynchronous logging is enabled, \see
+/// TRITONSERVER_ServerOptionsSetLogAsync, the message is copied to a
+/// ring buffer owned by the calling thread and the call returns
+/// without formatting or writing the message.
 ///
 /// \param level The log level.
 /// \param filename The file name of the location of the log message.
@@ -237,6 +305,16 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_LogMessage(
     TRITONSERVER_LogLevel level, const char* filename, const int line,
     const char* msg);
 
+/// Get the number of log messages that have been dropped, either
+/// because the ring buffer of the logging thread was full when
+/// asynchronous logging is enabled or because of rate limiting, \see
+/// TRITONSERVER_ServerOptionsSetLogRateLimit.
+///
+/// \param dropped_count Returns the number of dropped messages.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_LogDroppedMessageCount(
+    uint64_t* dropped_count);
+
 /// TRITONSERVER_Error
 ///
 /// Errors are reported by a TRITONSERVER_Error object. A NULL
@@ -441,6 +519,265 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ResponseAllocatorNew(
 TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ResponseAllocatorDelete(
     TRITONSERVER_ResponseAllocator* allocator);
 
+/// Create a new response allocator object that is implemented and
+/// managed by Triton, so that no allocation or release callback
+/// functions need to be provided. The allocator is used exactly like
+/// an allocator created with TRITONSERVER_ResponseAllocatorNew and
+/// can be shared by any number of inference requests. The
+/// 'response_allocator_userp' value given to
+/// TRITONSERVER_InferenceRequestSetResponseCallback is ignored by a
+/// pooled allocator and the 'buffer_userp' value associated with each
+/// allocated buffer is always nullptr.
+///
+/// The allocator keeps a separate pool for each memory type and
+/// memory type ID. Each pool rounds allocation requests up to a
+/// power-of-two size class and recycles the released buffers of a
+/// size class for subsequent allocations of the same class, so that
+/// for models producing fixed-size outputs almost all allocations are
+/// served without calling the underlying system or CUDA allocator.
+/// Released buffers are first returned to a small cache local to the
+/// releasing thread and only return to the shared pool when that
+/// cache is full, so the common allocate/release path does not
+/// require locking. The allocation preference given by Triton is
+/// always honored; only if memory of the preferred type cannot be
+/// allocated is the allocation served from CPU memory.
+///
+/// Requests larger than 'max_buffer_byte_size' bypass the pool and
+/// are allocated and released directly. Whenever the total size of
+/// the buffers held by a pool but not in use exceeds
+/// 'max_cached_byte_size', the least recently released buffers are
+/// freed until the pool is back below that high-water mark.
+///
+/// \param allocator Returns the new response allocator object.
+/// \param max_buffer_byte_size The largest allocation, in bytes, that
+/// is served from the pool. A value of 0 indicates that there is no
+/// limit.
+/// \param max_cached_byte_size The maximum number of bytes, for each
+/// memory type and memory type ID, of released buffers that are
+/// retained for reuse. A value of 0 indicates that there is no limit.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ResponseAllocatorNewPooled(
+    TRITONSERVER_ResponseAllocator** allocator,
+    const uint64_t max_buffer_byte_size, const uint64_t max_cached_byte_size);
+
+/// Get the usage statistics of the pool holding a given memory type
+/// and memory type ID in a response allocator created with
+/// TRITONSERVER_ResponseAllocatorNewPooled. TRITONSERVER_ERROR_INVALID_ARG
+/// is returned if 'allocator' is not a pooled allocator.
+///
+/// \param allocator The response allocator object.
+/// \param memory_type The memory type of the pool.
+/// \param memory_type_id The memory type ID of the pool.
+/// \param hit_count Returns the number of allocations served by a
+/// previously released buffer.
+/// \param miss_count Returns the number of allocations that required
+/// a new buffer to be allocated, including allocations that bypass
+/// the pool.
+/// \param cached_byte_size Returns the total size, in bytes, of the
+/// released buffers currently retained for reuse.
+/// \param peak_byte_size Returns the largest total size, in bytes, of
+/// the buffers held by the pool at any one time, both in use and
+/// retained for reuse.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ResponseAllocatorPoolStatistics(
+    TRITONSERVER_ResponseAllocator* allocator,
+    const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id,
+    uint64_t* hit_count, uint64_t* miss_count, uint64_t* cached_byte_size,
+    uint64_t* peak_byte_size);
+
+/// TRITONSERVER_MemoryRegion
+///
+/// Object representing a long-lived block of memory that has been
+/// registered with the server using
+/// TRITONSERVER_ServerRegisterMemoryRegion. Because a registered
+/// region is known to be stable for its entire lifetime, and is
+/// prepared once for access by the devices used by the server, Triton
+/// can read input tensors from and write output tensors to a region
+/// directly instead of staging copies of the data.
+///
+
+/// Kinds of memory region.
+///
+///   TRITONSERVER_MEMORY_REGION_SYSTEM: The region is ordinary CPU
+///     memory addressable by the server process, for example system
+///     shared memory that the caller has mapped into the process.
+///     'base' is the address of the region. Triton may page-lock the
+///     region for the lifetime of the registration so that copies
+///     between the region and GPU memory do not require staging.
+///
+///   TRITONSERVER_MEMORY_REGION_CPU_PINNED: The region is CPU memory
+///     that is already page-locked. 'base' is the address of the
+///     region.
+///
+///   TRITONSERVER_MEMORY_REGION_CUDA_IPC: The region is GPU memory
+///     exported by another process. 'base' points to the
+///     cudaIpcMemHandle_t for the memory and Triton opens the handle
+///     on the GPU indicated by the registration's memory type ID.
+///
+typedef enum tritonserver_memoryregionkind_enum {
+  TRITONSERVER_MEMORY_REGION_SYSTEM,
+  TRITONSERVER_MEMORY_REGION_CPU_PINNED,
+  TRITONSERVER_MEMORY_REGION_CUDA_IPC
+} TRITONSERVER_MemoryRegionKind;
+
+/// Get the properties of a registered memory region. The returned
+/// values are owned by 'region' and the lifetime of the returned
+/// base address extends only until the region is unregistered.
+///
+/// \param region The memory region.
+/// \param base Returns the base address of the region within the
+/// server process. For TRITONSERVER_MEMORY_REGION_CUDA_IPC this is the
+/// device address of the opened IPC handle.
+/// \param byte_size Returns the size of the region, in bytes.
+/// \param memory_type Returns the memory type of the region.
+/// \param memory_type_id Returns the memory type ID of the region.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_MemoryRegionProperties(
+    TRITONSERVER_MemoryRegion* region, const void** base, size_t* byte_size,
+    TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id);
+
+/// TRITONSERVER_ModelConfigView
+///
+/// Object representing a read-only, typed view of the configuration
+/// of a loaded model. The view is built once when the model is
+/// loaded, is immutable and is shared by reference by all users of the
+/// model, so accessing the configuration through the view does not
+/// parse or copy any data. All strings and arrays returned by the
+/// accessors are owned by the view and remain valid for the lifetime
+/// of the view.
+///
+
+/// Release a reference to a model configuration view acquired with
+/// TRITONSERVER_ServerModelConfigView. A view returned by
+/// TRITONBACKEND_ModelConfigView must not be released.
+///
+/// \param view The model configuration view.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ModelConfigViewRelease(
+    TRITONSERVER_ModelConfigView* view);
+
+/// Get the name and version of the model of a configuration view.
+///
+/// \param view The model configuration view.
+/// \param model_name Returns the name of the model.
+/// \param model_version Returns the version of the model.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ModelConfigViewName(
+    TRITONSERVER_ModelConfigView* view, const char** model_name,
+    int64_t* model_version);
+
+/// Get the backend and platform of a model configuration view.
+///
+/// \param view The model configuration view.
+/// \param backend Returns the backend of the model, or an empty
+/// string if not specified in the configuration.
+/// \param platform Returns the platform of the model, or an empty
+/// string if not specified in the configuration.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ModelConfigViewBackend(
+    TRITONSERVER_ModelConfigView* view, const char** backend,
+    const char** platform);
+
+/// Get the maximum batch size of a model configuration view.
+///
+/// \param view The model configuration view.
+/// \param max_batch_size Returns the maximum batch size. 0 indicates
+/// that the model does not support batching.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewMaxBatchSize(
+    TRITONSERVER_ModelConfigView* view, int32_t* max_batch_size);
+
+/// Get whether the model of a configuration view uses the decoupled
+/// transaction policy.
+///
+/// \param view The model configuration view.
+/// \param decoupled Returns true if the model is decoupled, false if
+/// not.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewDecoupled(
+    TRITONSERVER_ModelConfigView* view, bool* decoupled);
+
+/// Get the number of inputs of a model configuration view.
+///
+/// \param view The model configuration view.
+/// \param count Returns the number of inputs.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewInputCount(
+    TRITONSERVER_ModelConfigView* view, uint32_t* count);
+
+/// Get an input of a model configuration view. Inputs are indexed in
+/// the order they appear in the model configuration, which is also
+/// the order of their slots, \see TRITONBACKEND_ModelInputSlot. The
+/// shape does not include the batch dimension, and a dimension of -1
+/// indicates a variable-size dimension.
+///
+/// \param view The model configuration view.
+/// \param index The index of the input. Must be 0 <= index < count,
+/// where count is the value returned by
+/// TRITONSERVER_ModelConfigViewInputCount.
+/// \param name Returns the name of the input.
+/// \param datatype Returns the datatype of the input.
+/// \param shape Returns the shape of the input.
+/// \param dims_count Returns the number of dimensions of the input.
+/// \param optional Returns true if the input is optional, false if
+/// not.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ModelConfigViewInput(
+    TRITONSERVER_ModelConfigView* view, const uint32_t index,
+    const char** name, TRITONSERVER_DataType* datatype, const int64_t** shape,
+    uint32_t* dims_count, bool* optional);
+
+/// Get the number of outputs of a model configuration view.
+///
+/// \param view The model configuration view.
+/// \param count Returns the number of outputs.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewOutputCount(
+    TRITONSERVER_ModelConfigView* view, uint32_t* count);
+
+/// Get an output of a model configuration view. Outputs are indexed
+/// in the order they appear in the model configuration, which is also
+/// the order of their slots, \see TRITONBACKEND_ModelOutputSlot. The
+/// shape follows the same conventions as for
+/// TRITONSERVER_ModelConfigViewInput.
+///
+/// \param view The model configuration view.
+/// \param index The index of the output. Must be 0 <= index < count,
+/// where count is the value returned by
+/// TRITONSERVER_ModelConfigViewOutputCount.
+/// \param name Returns the name of the output.
+/// \param datatype Returns the datatype of the output.
+/// \param shape Returns the shape of the output.
+/// \param dims_count Returns the number of dimensions of the output.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ModelConfigViewOutput(
+    TRITONSERVER_ModelConfigView* view, const uint32_t index,
+    const char** name, TRITONSERVER_DataType* datatype, const int64_t** shape,
+    uint32_t* dims_count);
+
+/// Get the dynamic batching settings of a model configuration view.
+///
+/// \param view The model configuration view.
+/// \param enabled Returns true if dynamic batching is enabled for the
+/// model, false if not. If false the other values are not set.
+/// \param preferred_batch_sizes Returns the preferred batch sizes.
+/// \param preferred_batch_size_count Returns the number of preferred
+/// batch sizes.
+/// \param max_queue_delay_us Returns the maximum queue delay, in
+/// microseconds.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewDynamicBatching(
+    TRITONSERVER_ModelConfigView* view, bool* enabled,
+    const int32_t** preferred_batch_sizes,
+    uint32_t* preferred_batch_size_count, uint64_t* max_queue_delay_us);
+
 /// TRITONSERVER_Message
 ///
 /// Object representing a Triton Server message.
@@ -653,6 +990,32 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_InferenceTraceModelVersion(
     TRITONSERVER_InferenceTrace* trace, int64_t* model_version);
 
+/// A single trace activity recorded by sampled tracing, \see
+/// TRITONSERVER_ServerOptionsSetTraceSampling. New fields are only
+/// ever added at the end of the structure.
+typedef struct tritonserver_inferencetracerecord_struct {
+  /// The id of the trace, unique across all traces of the server.
+  uint64_t trace_id;
+  /// The parent id of the trace, or 0 if there is no parent trace.
+  uint64_t parent_id;
+  /// The name of the model. The string is owned by Triton and remains
+  /// valid for the lifetime of the server object.
+  const char* model_name;
+  int64_t model_version;
+  TRITONSERVER_InferenceTraceActivity activity;
+  uint64_t timestamp_ns;
+} TRITONSERVER_InferenceTraceRecord;
+
+/// Type for the callback function that receives batches of sampled
+/// trace records, \see TRITONSERVER_ServerOptionsSetTraceRecordsCallback.
+/// The 'records' array is owned by Triton and is valid only for the
+/// duration of the callback. The 'userp' data is the same as what is
+/// supplied in the call to
+/// TRITONSERVER_ServerOptionsSetTraceRecordsCallback.
+typedef void (*TRITONSERVER_InferenceTraceRecordsFn_t)(
+    const TRITONSERVER_InferenceTraceRecord* records,
+    const uint32_t record_count, void* userp);
+
 /// TRITONSERVER_InferenceRequest
 ///
 /// Object representing an inference request. The inference request
@@ -695,7 +1058,10 @@ typedef enum tritonserver_responsecompleteflag_enum {
 ///     function. Triton will not longer access the 'request' object
 ///     itself nor any input tensor data associated with the
 ///     request. The callback should free or otherwise manage the
-///     'request' object and all associated tensor data.
+///     'request' object and all associated tensor data. To reuse the
+///     request for another inference the callback, or the thread it
+///     hands the request to, can call TRITONSERVER_InferenceRequestReset
+///     instead of TRITONSERVER_InferenceRequestDelete.
 ///
 /// Note that currently TRITONSERVER_REQUEST_RELEASE_ALL should always
 /// be set when the callback is invoked but in the future that may
@@ -726,7 +1092,32 @@ typedef void (*TRITONSERVER_InferenceResponseCompleteFn_t)(
     TRITONSERVER_InferenceResponse* response, const uint32_t flags,
     void* userp);
 
-/// Create a new inference request object.
+/// Type for callback function delivering a batch of completed
+/// inference responses, possibly for different requests, in one
+/// call. The callback function takes ownership of each
+/// TRITONSERVER_InferenceResponse object in 'responses'. The
+/// 'responses', 'flags' and 'userps' arrays are owned by Triton and
+/// are valid only for the duration of the call. Entry i of 'flags'
+/// holds the TRITONSERVER_ResponseCompleteFlag values for entry i of
+/// 'responses', with the same meaning as the 'flags' argument of
+/// TRITONSERVER_InferenceResponseCompleteFn_t, and entry i of 'userps'
+/// is the data provided as 'response_userp' in the call to
+/// TRITONSERVER_InferenceRequestSetResponseBatchCallback for the
+/// request that produced entry i of 'responses'. As with
+/// TRITONSERVER_InferenceResponseCompleteFn_t an entry of 'responses'
+/// may be nullptr if its flags include
+/// TRITONSERVER_RESPONSE_COMPLETE_FINAL. Responses are delivered in
+/// the order they were sent and the responses of a given request are
+/// never reordered.
+typedef void (*TRITONSERVER_InferenceResponseBatchCompleteFn_t)(
+    TRITONSERVER_InferenceResponse** responses, const uint32_t* flags,
+    void** userps, const uint32_t response_count);
+
+/// Create a new inference request object. The storage for the request
+/// and for its inputs, shapes and requested outputs is taken from a
+/// pool owned by the model, so creating a request whose inputs and
+/// outputs have the same names as a previously deleted request of the
+/// same model does not allocate memory.
 ///
 /// \param inference_request Returns the new request object.
 /// \param server the inference server object.
@@ -740,13 +1131,33 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_InferenceRequestNew(
     TRITONSERVER_Server* server, const char* model_name,
     const int64_t model_version);
 
-/// Delete an inference request object.
+/// Delete an inference request object. The storage of the request is
+/// returned to the pool of the model, \see
+/// TRITONSERVER_InferenceRequestNew.
 ///
 /// \param inference_request The request object.
 /// \return a TRITONSERVER_Error indicating success or failure.
 TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_InferenceRequestDelete(
     TRITONSERVER_InferenceRequest* inference_request);
 
+/// Reset an inference request object so that it can be used for
+/// another inference. All input data is cleared, releasing ownership
+/// of the buffer(s) that were appended to the inputs, as if
+/// TRITONSERVER_InferenceRequestRemoveAllInputData was called for each
+/// input. The inputs, their datatypes and shapes, the requested
+/// outputs, the release and response callbacks and all other request
+/// settings are kept, so for a request with the same input and output
+/// signature as the previous one only the input data needs to be
+/// appended before the request is passed to
+/// TRITONSERVER_ServerInferAsync again. The request must not be reset
+/// while it is in flight, that is, only after ownership of the
+/// request has been returned to the caller by the release callback.
+///
+/// \param inference_request The request object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_InferenceRequestReset(
+    TRITONSERVER_InferenceRequest* inference_request);
+
 /// Get the ID for a request. The returned ID is owned by
 /// 'inference_request' and must not be modified or freed by the
 /// caller.
@@ -873,7 +1284,10 @@ TRITONSERVER_InferenceRequestTimeoutMicroseconds(
     TRITONSERVER_InferenceRequest* inference_request, uint64_t* timeout_us);
 
 /// Set the timeout for a request, in microseconds. The default is 0
-/// which indicates that the request has no timeout.
+/// which indicates that the request has no timeout. When the rate
+/// limit mode is TRITONSERVER_RATE_LIMIT_DEADLINE the timeout also
+/// determines the scheduling order of the request, \see
+/// TRITONSERVER_ServerOptionsSetRateLimiterMode.
 ///
 /// \param inference_request The request object.
 /// \param timeout_us The timeout, in microseconds.
@@ -959,6 +1373,67 @@ TRITONSERVER_InferenceRequestAppendInputDataWithHostPolicy(
     const void* base, size_t byte_size, TRITONSERVER_MemoryType memory_type,
     int64_t memory_type_id, const char* host_policy_name);
 
+/// Assign a block of a registered memory region to an input. The
+/// block is appended to any existing buffers for that input, as with
+/// TRITONSERVER_InferenceRequestAppendInputData. The memory type and
+/// memory type ID of the data are those of the region. Because the
+/// region is known to be stable, Triton delivers the block to the
+/// backend without copying it whenever the backend accepts that
+/// memory type, so TRITONBACKEND_InputBuffer returns a pointer
+/// directly into the region. The region must remain registered until
+/// ownership of the block is released by 'inference_request' being
+/// deleted or by the input being removed from 'inference_request'.
+///
+/// \param inference_request The request object.
+/// \param name The name of the input.
+/// \param region The registered memory region holding the data.
+/// \param offset The offset, in bytes, of the data within 'region'.
+/// \param byte_size The size, in bytes, of the input data. 'offset' +
+/// 'byte_size' must not exceed the size of 'region'.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestAppendInputDataFromRegion(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    TRITONSERVER_MemoryRegion* region, size_t offset, size_t byte_size);
+
+/// Add an input to a request whose data is an output of an inference
+/// response, forwarding the output buffer by reference instead of
+/// copying it. The input has the datatype and shape of the output,
+/// and its data stays in the memory the response allocator placed it
+/// in, so an output in GPU memory remains on the device. This allows
+/// the responses of one model to be fed to another model as soon as
+/// the response callback delivers them, without routing the data
+/// through the client.
+///
+/// 'inference_request' takes a reference to 'inference_response'. The
+/// caller may delete the response as usual with
+/// TRITONSERVER_InferenceResponseDelete, but the output buffers of the
+/// response are not released to its response allocator until
+/// 'inference_request' also releases the reference, by being deleted,
+/// by the input being removed or by the input data being removed. The
+/// response allocator that allocated the response must remain valid
+/// until then. If the output was written to a block of a memory region
+/// (\see TRITONSERVER_InferenceRequestSetRequestedOutputRegion) the
+/// response also keeps the region registered until then, so
+/// TRITONSERVER_ServerUnregisterMemoryRegion returns
+/// TRITONSERVER_ERROR_UNAVAILABLE while the request holds the
+/// reference. The output data must not be modified while the request
+/// holds the reference.
+///
+/// \param inference_request The request object.
+/// \param name The name of the input. The request must not already
+/// have an input with this name.
+/// \param inference_response The response object holding the output.
+/// Must be a successful response.
+/// \param output_index The index of the output within
+/// 'inference_response', as for TRITONSERVER_InferenceResponseOutput.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestAddInputFromResponseOutput(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    TRITONSERVER_InferenceResponse* inference_response,
+    const uint32_t output_index);
+
 /// Clear all input data from an input, releasing ownership of the
 /// buffer(s) that were appended to the input with
 /// TRITONSERVER_InferenceRequestAppendInputData or
@@ -969,6 +1444,22 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_InferenceRequestRemoveAllInputData(
     TRITONSERVER_InferenceRequest* inference_request, const char* name);
 
+/// Set the layout of the data appended to a BYTES input. The buffers
+/// appended to the input together hold the data in that layout. The
+/// default is TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED. Triton
+/// converts the data if the backend reads the input in a different
+/// layout, \see TRITONBACKEND_InputSetBytesLayout.
+///
+/// \param inference_request The request object.
+/// \param name The name of the input. The input must have datatype
+/// TRITONSERVER_TYPE_BYTES.
+/// \param layout The layout of the input data.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetInputBytesLayout(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    const TRITONSERVER_BytesLayout layout);
+
 /// Add an output request to an inference request.
 ///
 /// \param inference_request The request object.
@@ -978,6 +1469,46 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_InferenceRequestAddRequestedOutput(
     TRITONSERVER_InferenceRequest* inference_request, const char* name);
 
+/// Direct a requested output to a block of a registered memory
+/// region. The output must have been added to the request with
+/// TRITONSERVER_InferenceRequestAddRequestedOutput. Triton places the
+/// output tensor directly into the block instead of calling the
+/// response allocator's allocation function for that output, and the
+/// corresponding release function is not called when the response is
+/// deleted. The base address, memory type and memory type ID returned
+/// for the output by TRITONSERVER_InferenceResponseOutput refer to
+/// the block within the region. If the output tensor produced by the
+/// model is larger than 'byte_size' the response is returned with an
+/// error. The region must remain registered until every response
+/// produced for the request has been deleted.
+///
+/// \param inference_request The request object.
+/// \param name The name of the output.
+/// \param region The registered memory region to hold the output.
+/// \param offset The offset, in bytes, of the block within 'region'.
+/// \param byte_size The size, in bytes, of the block. 'offset' +
+/// 'byte_size' must not exceed the size of 'region'.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetRequestedOutputRegion(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    TRITONSERVER_MemoryRegion* region, size_t offset, size_t byte_size);
+
+/// Set the layout in which a requested BYTES output is returned. The
+/// default is TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED. The setting
+/// has no effect on outputs that do not have datatype
+/// TRITONSERVER_TYPE_BYTES.
+///
+/// \param inference_request The request object.
+/// \param name The name of the output. The output must have been
+/// requested with TRITONSERVER_InferenceRequestAddRequestedOutput.
+/// \param layout The layout of the output data.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetRequestedOutputBytesLayout(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    const TRITONSERVER_BytesLayout layout);
+
 /// Remove an output request from an inference request.
 ///
 /// \param inference_request The request object.
@@ -1035,6 +1566,58 @@ TRITONSERVER_InferenceRequestSetResponseCallback(
     TRITONSERVER_InferenceResponseCompleteFn_t response_fn,
     void* response_userp);
 
+/// Set the allocator and batch response callback for an inference
+/// request. This is an alternative to
+/// TRITONSERVER_InferenceRequestSetResponseCallback for front-ends
+/// that serve many concurrent streams from decoupled models. When a
+/// backend sends several responses together with
+/// TRITONBACKEND_ResponseSendBatch, the responses for all requests
+/// that set the same 'response_fn' are delivered in a single call of
+/// that function instead of one call per response. A response sent on
+/// its own is delivered as a batch of one. Setting a batch response
+/// callback replaces any response callback set with
+/// TRITONSERVER_InferenceRequestSetResponseCallback, and vice versa.
+///
+/// \param inference_request The request object.
+/// \param response_allocator The TRITONSERVER_ResponseAllocator to use
+/// to allocate buffers to hold inference results.
+/// \param response_allocator_userp User-provided pointer that is
+/// delivered to the response allocator's start and allocation functions.
+/// \param response_fn The function called to deliver batches of
+/// inference responses for this request.
+/// \param response_userp User-provided pointer that is delivered to
+/// the 'response_fn' callback for each response of this request.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetResponseBatchCallback(
+    TRITONSERVER_InferenceRequest* inference_request,
+    TRITONSERVER_ResponseAllocator* response_allocator,
+    void* response_allocator_userp,
+    TRITONSERVER_InferenceResponseBatchCompleteFn_t response_fn,
+    void* response_userp);
+
+/// Set the response coalescing window of an inference request. With a
+/// non-zero window, a response for the request that does not have
+/// TRITONSERVER_RESPONSE_COMPLETE_FINAL set is held for up to
+/// 'window_us' microseconds and consecutive held responses are
+/// merged into one response before delivery: each output of the
+/// merged response is the concatenation, along the first dimension,
+/// of the outputs with that name. A held response is delivered
+/// without merging when the next response does not have the same
+/// output names, datatypes and non-leading dimensions, or is an
+/// error. Held responses are delivered, merged, no later than the
+/// end of the window or together with the final response of the
+/// request, whichever comes first. The default window of 0 delivers
+/// every response as soon as it is sent.
+///
+/// \param inference_request The request object.
+/// \param window_us The coalescing window, in microseconds.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetResponseCoalescing(
+    TRITONSERVER_InferenceRequest* inference_request,
+    const uint64_t window_us);
+
 /// TRITONSERVER_InferenceResponse
 ///
 /// Object representing an inference response. The inference response
@@ -1170,6 +1753,25 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_InferenceResponseOutput(
     TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id,
     void** userp);
 
+/// Get the layout of the data of a BYTES output. This is the layout
+/// set with TRITONSERVER_InferenceRequestSetRequestedOutputBytesLayout,
+/// or TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED if none was set or the
+/// output does not have datatype TRITONSERVER_TYPE_BYTES. An input
+/// added from the output with
+/// TRITONSERVER_InferenceRequestAddInputFromResponseOutput has the
+/// same layout.
+///
+/// \param inference_response The response object.
+/// \param index The index of the output tensor, must be 0 <= index <
+/// count, where 'count' is the value returned by
+/// TRITONSERVER_InferenceResponseOutputCount.
+/// \param layout Returns the layout of the output data.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseOutputBytesLayout(
+    TRITONSERVER_InferenceResponse* inference_response, const uint32_t index,
+    TRITONSERVER_BytesLayout* layout);
+
 /// Get a classification label associated with an output for a given
 /// index.  The caller does not own the returned label and must not
 /// modify or delete it. The lifetime of all returned label extends
@@ -1201,10 +1803,17 @@ typedef enum tritonserver_modelcontrolmode_enum {
   TRITONSERVER_MODEL_CONTROL_EXPLICIT
 } TRITONSERVER_ModelControlMode;
 
+/// Model repository poll modes
+typedef enum tritonserver_repositorypollmode_enum {
+  TRITONSERVER_REPOSITORY_POLL_FULL,
+  TRITONSERVER_REPOSITORY_POLL_INCREMENTAL
+} TRITONSERVER_RepositoryPollMode;
+
 /// Rate limit modes
 typedef enum tritonserver_ratelimitmode_enum {
   TRITONSERVER_RATE_LIMIT_OFF,
-  TRITONSERVER_RATE_LIMIT_EXEC_COUNT
+  TRITONSERVER_RATE_LIMIT_EXEC_COUNT,
+  TRITONSERVER_RATE_LIMIT_DEADLINE
 } TRITONSERVER_RateLimitMode;
 
 /// Create a new server options object. The caller takes ownership of
@@ -1269,11 +1878,97 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_ServerOptionsSetModelControlMode(
     TRITONSERVER_ServerOptions* options, TRITONSERVER_ModelControlMode mode);
 
+/// Set the model repository poll mode in a server options. The mode
+/// determines how TRITONSERVER_ServerPollModelRepository, and the
+/// periodic polling of TRITONSERVER_MODEL_CONTROL_POLL mode, detect
+/// changes in the model repositories.
+///
+///   TRITONSERVER_REPOSITORY_POLL_FULL: every poll lists the entire
+///   tree of each model repository and reads the configuration of
+///   every model.
+///
+///   TRITONSERVER_REPOSITORY_POLL_INCREMENTAL: changes are tracked
+///   between polls and a poll examines only the models that may have
+///   changed. For repositories on a local filesystem changes are
+///   reported by inotify. For repositories in cloud storage the etag,
+///   or the generation, of each object is recorded and a poll lists
+///   only object metadata, comparing it with the recorded values.
+///   Where neither is available the model directories are listed but
+///   their contents are read only if their modification time has
+///   changed. In all cases the content hash of each config.pbtxt is
+///   recorded, and a model whose configuration and version
+///   directories are unchanged is neither re-read nor reloaded. If
+///   change notification fails, for example because the inotify watch
+///   limit is exhausted, the next poll falls back to a full poll.
+///
+/// \param options The server options object.
+/// \param mode The poll mode. The default is
+/// TRITONSERVER_REPOSITORY_POLL_FULL.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelRepositoryPollMode(
+    TRITONSERVER_ServerOptions* options, TRITONSERVER_RepositoryPollMode mode);
+
+/// Set the directory of the local model artifact cache in a server
+/// options. When set, the artifacts of models in remote model
+/// repositories, for example repositories with an "s3://", "gs://" or
+/// "as://" prefix, are downloaded into the cache instead of into a
+/// temporary directory for each load. Cached files are addressed by
+/// the content hash reported by the storage service (the etag, or the
+/// content MD5 or CRC32C), so loading or reloading a model whose
+/// artifacts are unchanged does not download them again, and
+/// identical artifacts shared by several models or versions are
+/// stored once. The cache is persistent across server restarts. By
+/// default no cache is used.
+///
+/// \param options The server options object.
+/// \param cache_dir The full path of the cache directory.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelRepositoryCacheDirectory(
+    TRITONSERVER_ServerOptions* options, const char* cache_dir);
+
+/// Set the maximum size of the local model artifact cache in a server
+/// options, \see TRITONSERVER_ServerOptionsSetModelRepositoryCacheDirectory.
+/// When the cache exceeds the size the least recently used artifacts
+/// that do not belong to a loaded model are evicted. The default is 0,
+/// which indicates no limit.
+///
+/// \param options The server options object.
+/// \param size The maximum cache size, in bytes.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelRepositoryCacheByteSize(
+    TRITONSERVER_ServerOptions* options, uint64_t size);
+
+/// Set the parallelism used to download model artifacts from remote
+/// model repositories in a server options. Artifacts are downloaded
+/// concurrently by a pool of threads, and artifacts larger than
+/// 'part_byte_size' are divided into parts that are downloaded
+/// concurrently using ranged or multipart transfers. The download of
+/// the artifacts of the startup models, \see
+/// TRITONSERVER_ServerOptionsSetStartupModel, starts when the server is
+/// created, before their loads are scheduled.
+///
+/// \param options The server options object.
+/// \param thread_count The number of download threads. The default is
+/// 8.
+/// \param part_byte_size The size of each part, in bytes. The default
+/// is 8 MiB. 0 disables ranged transfers.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelRepositoryDownloadParallelism(
+    TRITONSERVER_ServerOptions* options, unsigned int thread_count,
+    uint64_t part_byte_size);
+
 /// Set the model to be loaded at startup in a server options. The model must be
 /// present in one, and only one, of the specified model repositories.
 /// This function can be called multiple times with different model name
 /// to set multiple startup models.
 /// Note that it only takes affect on TRITONSERVER_MODEL_CONTROL_EXPLICIT mode.
+/// The artifacts of startup models in remote model repositories are
+/// prefetched as soon as the server is created, \see
+/// TRITONSERVER_ServerOptionsSetModelRepositoryDownloadParallelism.
 ///
 /// \param options The server options object.
 /// \param mode_name The name of the model to load on startup.
@@ -1282,6 +1977,47 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_ServerOptionsSetStartupModel(
     TRITONSERVER_ServerOptions* options, const char* model_name);
 
+/// Set the number of threads used to load models concurrently in a
+/// server options. The startup models, the models of the repository in
+/// TRITONSERVER_MODEL_CONTROL_NONE and TRITONSERVER_MODEL_CONTROL_POLL
+/// modes, and the models loaded by a single poll or load call are
+/// loaded in parallel, up to this number at a time. A model is not
+/// loaded until the models it depends on, for example the composing
+/// models of an ensemble, have finished loading, and a model is not
+/// loaded if that would exceed the load memory limit of a device it
+/// uses, \see TRITONSERVER_ServerOptionsSetModelLoadGpuMemoryLimit.
+///
+/// Parallel loading does not change the semantics of exit-on-error and
+/// strict readiness: TRITONSERVER_ServerNew returns only after all
+/// loads have completed, and if exit-on-error is enabled and any model
+/// fails to load the loads still in progress are allowed to complete,
+/// pending loads are cancelled, and TRITONSERVER_ServerNew returns an
+/// error. The default is 1, which loads models serially.
+///
+/// \param options The server options object.
+/// \param thread_count The number of threads.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelLoadThreadCount(
+    TRITONSERVER_ServerOptions* options, unsigned int thread_count);
+
+/// Set the limit on the GPU memory that models being loaded
+/// concurrently may use on a device in a server options. Before a
+/// model is loaded its GPU memory use is estimated from the size of
+/// its model files, or from the memory it used when it was last
+/// loaded, and the load is deferred while the estimates of the loads
+/// in progress on a device would exceed the limit. A model whose
+/// estimate alone exceeds the limit is loaded when no other load is in
+/// progress on the device. The default is no limit.
+///
+/// \param options The server options object.
+/// \param gpu_device The GPU device to set the limit for.
+/// \param size The limit, in bytes.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelLoadGpuMemoryLimit(
+    TRITONSERVER_ServerOptions* options, int gpu_device, uint64_t size);
+
 /// Enable or disable strict model configuration handling in a server
 /// options.
 ///
@@ -1303,6 +2039,21 @@ TRITONSERVER_ServerOptionsSetStrictModelConfig(
 ///   TRITONSERVER_RATE_LIMIT_OFF: The rate limiting is turned off and the
 ///   inference gets executed whenever an instance is available.
 ///
+///   TRITONSERVER_RATE_LIMIT_DEADLINE: The rate limiting schedules the
+///   inference execution by request deadline, in addition to the resource
+///   constraints of TRITONSERVER_RATE_LIMIT_EXEC_COUNT. The deadline of a
+///   request is the time it was enqueued plus its timeout, \see
+///   TRITONSERVER_InferenceRequestSetTimeoutMicroseconds. Within a priority
+///   level queued requests are ordered earliest-deadline-first, with
+///   requests that have no timeout ordered after all requests that have
+///   one. The scheduler records the observed compute time of each model
+///   instance for each batch size and uses it to form dynamic batches no
+///   larger than can complete before the tightest deadline in the batch.
+///   A request that can no longer complete before its deadline, even in a
+///   batch of size 1, is removed from the queue without being executed
+///   and completed with a TRITONSERVER_ERROR_UNAVAILABLE error, and is
+///   reported in the "fail" statistics of the model.
+///
 /// \param options The server options object.
 /// \param mode The mode to use for the rate limiting. By default, execution
 /// count is used to determine the priorities.
@@ -1311,6 +2062,50 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_ServerOptionsSetRateLimiterMode(
     TRITONSERVER_ServerOptions* options, TRITONSERVER_RateLimitMode mode);
 
+/// Enable load-driven activation of the passive instances of a model.
+/// Passive instances of the model (\see
+/// TRITONBACKEND_ModelInstanceIsPassive) start inactive and the
+/// scheduler does not send requests to them. The scheduler samples the
+/// queue of the model and activates one passive instance when the
+/// number of queued requests per active instance exceeds
+/// 'activate_queue_depth' or the queue duration of the oldest queued
+/// request exceeds 'activate_queue_delay_us'. It deactivates one
+/// previously activated instance, after the requests already sent to
+/// it complete, when the number of queued requests per active instance
+/// and the queue duration of the oldest queued request are both below
+/// 'deactivate_queue_depth' and 'deactivate_queue_delay_us'. A
+/// condition must hold continuously for 'hysteresis_ms' before the
+/// transition is made, and at most one transition is made for the
+/// model in each 'hysteresis_ms' period. Non-passive instances are
+/// always active. A threshold of 0 disables the corresponding
+/// condition. Each transition is reported in the statistics of the
+/// model, \see TRITONSERVER_ServerModelStatistics.
+///
+/// \param options The server options object.
+/// \param model_name The name of the model.
+/// \param activate_queue_depth The number of queued requests per active
+/// instance above which a passive instance is activated.
+/// \param activate_queue_delay_us The queue duration, in microseconds,
+/// above which a passive instance is activated.
+/// \param deactivate_queue_depth The number of queued requests per
+/// active instance below which an activated instance is deactivated.
+/// Must not be greater than 'activate_queue_depth' unless that
+/// threshold is disabled.
+/// \param deactivate_queue_delay_us The queue duration, in
+/// microseconds, below which an activated instance is deactivated.
+/// Must not be greater than 'activate_queue_delay_us' unless that
+/// threshold is disabled.
+/// \param hysteresis_ms The duration, in milliseconds, that a condition
+/// must hold before an instance is activated or deactivated.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelInstanceActivation(
+    TRITONSERVER_ServerOptions* options, const char* model_name,
+    const uint32_t activate_queue_depth,
+    const uint64_t activate_queue_delay_us,
+    const uint32_t deactivate_queue_depth,
+    const uint64_t deactivate_queue_delay_us, const uint64_t hysteresis_ms);
+
 /// Add resource count for rate limiting.
 ///
 /// \param options The server options object.
@@ -1332,7 +2127,10 @@ TRITONSERVER_ServerOptionsAddRateLimiterResource(
 /// Set the total pinned memory byte size that the server can allocate
 /// in a server options. The pinned memory pool will be shared across
 /// Triton itself and the backends that use
-/// TRITONBACKEND_MemoryManager to allocate memory.
+/// TRITONBACKEND_MemoryManager to allocate memory. If pinned memory
+/// pools are also set for NUMA nodes, \see
+/// TRITONSERVER_ServerOptionsSetNumaPinnedMemoryPoolByteSize, this pool
+/// is used only for allocations not associated with a NUMA node.
 ///
 /// \param options The server options object.
 /// \param size The pinned memory pool byte size.
@@ -1341,10 +2139,27 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_ServerOptionsSetPinnedMemoryPoolByteSize(
     TRITONSERVER_ServerOptions* options, uint64_t size);
 
+/// Set the pinned memory byte size that the server can allocate on a
+/// given NUMA node in a server options. The pool is allocated from
+/// memory local to the node and is used for the pinned allocations of
+/// the model instances whose host policy sets "numa-node" to the node,
+/// \see TRITONSERVER_ServerOptionsSetHostPolicy. Can be called
+/// multiple times for different nodes.
+///
+/// \param options The server options object.
+/// \param numa_node The NUMA node to set the pool size for.
+/// \param size The pinned memory pool byte size.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetNumaPinnedMemoryPoolByteSize(
+    TRITONSERVER_ServerOptions* options, int numa_node, uint64_t size);
+
 /// Set the total CUDA memory byte size that the server can allocate
 /// on given GPU device in a server options. The pinned memory pool
 /// will be shared across Triton itself and the backends that use
-/// TRITONBACKEND_MemoryManager to allocate memory.
+/// TRITONBACKEND_MemoryManager to allocate memory. The size is the
+/// initial size of the pool, which can grow up to the limit set with
+/// TRITONSERVER_ServerOptionsSetCudaMemoryPoolLimit.
 ///
 /// \param options The server options object.
 /// \param gpu_device The GPU device to allocate the memory pool.
@@ -1354,9 +2169,57 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_ServerOptionsSetCudaMemoryPoolByteSize(
     TRITONSERVER_ServerOptions* options, int gpu_device, uint64_t size);
 
+/// Set the maximum size that the CUDA memory pool of a given GPU
+/// device can grow to in a server options. When an allocation cannot
+/// be satisfied from the pool, the pool reserves additional device
+/// memory until it reaches the limit. The pool supports stream-ordered
+/// allocation, \see TRITONBACKEND_MemoryManagerAllocateAsync, and is
+/// backed by cudaMallocAsync where the device supports it. Allocations
+/// that cannot be satisfied even after the pool reaches the limit fall
+/// back to allocating outside of the pool.
+///
+/// The state of each pool is reported by the following metrics,
+/// labeled with the UUID of the GPU:
+/// nv_gpu_memory_pool_reserved_bytes and nv_gpu_memory_pool_used_bytes,
+/// the current reserved and allocated size of the pool;
+/// nv_gpu_memory_pool_peak_used_bytes, the maximum allocated size;
+/// nv_gpu_memory_pool_fragmentation, one minus the ratio of the largest
+/// free block to the total free size; and
+/// nv_gpu_memory_pool_fallback_total, the number of allocations that
+/// fell back to allocating outside of the pool.
+///
+/// \param options The server options object.
+/// \param gpu_device The GPU device to set the limit for.
+/// \param max_size The maximum CUDA memory pool byte size. The default
+/// is the initial size of the pool, so the pool does not grow.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetCudaMemoryPoolLimit(
+    TRITONSERVER_ServerOptions* options, int gpu_device, uint64_t max_size);
+
+/// Set the time after which the GPU sequence state of an idle
+/// sequence is spilled to pinned host memory in a server options.
+/// A spilled state is moved back to its GPU when the next request of
+/// the sequence is executed, so the GPU memory held by sequences that
+/// are waiting for their next request is bounded by the active
+/// sequences. \see TRITONBACKEND_State. The spilled states of all
+/// models are reported by the nv_sequence_state_spilled_bytes metric.
+///
+/// \param options The server options object.
+/// \param idle_timeout_us The time, in microseconds, that a sequence
+/// must be idle before its state is spilled. If 0, the default, states
+/// are never spilled.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetSequenceStateSpillTimeout(
+    TRITONSERVER_ServerOptions* options, uint64_t idle_timeout_us);
+
 /// Set the total response cache byte size that the server can allocate in CPU
 /// memory. The response cache will be shared across all inference requests and
-/// across all models.
+/// across all models. The cache is divided evenly among its shards, \see
+/// TRITONSERVER_ServerOptionsSetResponseCacheShardCount. Models given a
+/// dedicated cache with TRITONSERVER_ServerOptionsSetModelResponseCache do
+/// not use the shared cache.
 ///
 /// \param options The server options object.
 /// \param size The total response cache byte size.
@@ -1365,6 +2228,41 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_ServerOptionsSetResponseCacheByteSize(
     TRITONSERVER_ServerOptions* options, uint64_t size);
 
+/// Set the number of shards of the response cache in a server
+/// options. Each shard has its own lock and least-recently-used
+/// eviction, and a request is assigned to a shard by the hash of its
+/// model name, model version and input tensors, so lookups for
+/// different requests rarely contend. Inputs are hashed with XXH3,
+/// which processes large tensors at close to memory bandwidth. The
+/// default is one shard per available CPU core, rounded up to a power
+/// of 2.
+///
+/// \param options The server options object.
+/// \param shard_count The number of shards. Must be a power of 2.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetResponseCacheShardCount(
+    TRITONSERVER_ServerOptions* options, uint32_t shard_count);
+
+/// Set the response cache policy of a model in a server options. The
+/// policy overrides the "response_cache" setting in the model
+/// configuration. Can be called multiple times for different models.
+///
+/// \param options The server options object.
+/// \param model_name The name of the model.
+/// \param enable If true the responses of the model are cached.
+/// \param byte_size The byte size of a cache dedicated to the model,
+/// divided among the same number of shards as the shared cache. If 0
+/// the model uses the shared cache.
+/// \param ttl_ms The time, in milliseconds, after which a cached
+/// response is no longer used and is evicted. If 0 cached responses do
+/// not expire.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelResponseCache(
+    TRITONSERVER_ServerOptions* options, const char* model_name,
+    bool enable, uint64_t byte_size, uint64_t ttl_ms);
+
 /// Set the minimum support CUDA compute capability in a server
 /// options.
 ///
@@ -1386,6 +2284,9 @@ TRITONSERVER_ServerOptionsSetExitOnError(
     TRITONSERVER_ServerOptions* options, bool exit);
 
 /// Enable or disable strict readiness handling in a server options.
+/// When models are loaded in parallel, \see
+/// TRITONSERVER_ServerOptionsSetModelLoadThreadCount, the server
+/// becomes ready only after all startup loads have completed.
 ///
 /// \param options The server options object.
 /// \param strict True to enable strict readiness handling, false to
@@ -1445,6 +2346,47 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_ServerOptionsSetLogVerbose(
     TRITONSERVER_ServerOptions* options, int level);
 
+/// Enable or disable asynchronous logging in a server options. With
+/// asynchronous logging each thread that logs a message appends the
+/// unformatted message, its level, location and timestamp to a
+/// lock-free ring buffer owned by the thread. A dedicated writer
+/// thread drains the buffers, formats the messages and writes them in
+/// batches, so logging does not block the calling thread on I/O. If a
+/// buffer is full when a message is logged the message is dropped and
+/// counted, \see TRITONSERVER_LogDroppedMessageCount. Pending messages
+/// are written before the server is deleted, and error messages are
+/// also written before the process aborts on a fatal error.
+///
+/// \param options The server options object.
+/// \param enable True to enable asynchronous logging, false to
+/// disable.
+/// \param buffer_entry_count The number of messages held by the ring
+/// buffer of each thread.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetLogAsync(
+    TRITONSERVER_ServerOptions* options, bool enable,
+    uint32_t buffer_entry_count);
+
+/// Set the rate limit for repeated log messages in a server options.
+/// A message is repeated if it is logged from the same file and line
+/// as an earlier message. At most 'burst_count' repetitions of a
+/// message are logged in each interval of 'interval_ms'
+/// milliseconds. Further repetitions are dropped and counted, and the
+/// number of repetitions dropped is logged with the first repetition
+/// of the next interval. The default is 0, which disables rate
+/// limiting.
+///
+/// \param options The server options object.
+/// \param burst_count The number of repetitions logged in each
+/// interval. 0 disables rate limiting.
+/// \param interval_ms The length of each interval, in milliseconds.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetLogRateLimit(
+    TRITONSERVER_ServerOptions* options, uint32_t burst_count,
+    uint64_t interval_ms);
+
 /// Enable or disable metrics collection in a server options.
 ///
 /// \param options The server options object.
@@ -1475,6 +2417,91 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error*
 TRITONSERVER_ServerOptionsSetMetricsInterval(
     TRITONSERVER_ServerOptions* options, uint64_t metrics_interval_ms);
 
+/// Enable or disable latency histograms in a server options. When
+/// enabled, the queue, compute-input, compute-infer and compute-output
+/// durations of every request are recorded, for each model and each
+/// model instance, in a log-linear histogram in addition to the
+/// cumulative count and duration that are always collected. Each
+/// power-of-two range of durations is divided into
+/// 2^'precision_bits' equally sized buckets, so that any percentile
+/// derived from a histogram is accurate to within a relative error of
+/// 2^-'precision_bits'. Recording is performed by the thread that
+/// reports the statistics into a histogram shard owned by that thread
+/// using only relaxed atomic increments, and the shards are merged
+/// when statistics are read, so enabling histograms adds no
+/// contention between threads.
+///
+/// The histograms are returned by TRITONSERVER_ServerModelStatistics
+/// and, when metrics are enabled, are published by
+/// TRITONSERVER_MetricsFormatted as the Prometheus histograms
+/// nv_inference_queue_latency_us, nv_inference_compute_input_latency_us,
+/// nv_inference_compute_infer_latency_us and
+/// nv_inference_compute_output_latency_us. To limit the number of
+/// Prometheus series, the published histograms merge the buckets of
+/// each power-of-two range into a single bucket.
+///
+/// \param options The server options object.
+/// \param enable True to enable latency histograms, false to disable.
+/// \param precision_bits The number of bits of precision of the
+/// histogram buckets. Must be 0 <= 'precision_bits' <= 7.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetLatencyHistograms(
+    TRITONSERVER_ServerOptions* options, bool enable,
+    uint32_t precision_bits);
+
+/// Set sampled tracing in a server options. With sampled tracing
+/// Triton itself traces one of every 'sample_rate' inference requests
+/// that are not explicitly traced with a TRITONSERVER_InferenceTrace,
+/// without creating a trace object or invoking a callback for each
+/// activity. Each activity of a sampled request is appended as a
+/// TRITONSERVER_InferenceTraceRecord to a fixed-size ring buffer owned
+/// by the thread on which the activity occurs. The buffers are
+/// single-producer and lock-free, so recording an activity costs only
+/// a timestamp and a few stores. If a buffer is full when an activity
+/// occurs the oldest record in the buffer is overwritten and counted
+/// as dropped.
+///
+/// Records are drained from the buffers in batches, either by a
+/// background thread that delivers them to the callback set with
+/// TRITONSERVER_ServerOptionsSetTraceRecordsCallback or, if no
+/// callback is set, by calls to TRITONSERVER_ServerTraceRecords.
+///
+/// \param options The server options object.
+/// \param level The trace level for sampled requests.
+/// TRITONSERVER_TRACE_LEVEL_DISABLED disables sampled tracing.
+/// \param sample_rate Trace one of every 'sample_rate' requests. A
+/// value of 0 disables sampled tracing.
+/// \param buffer_record_count The number of records held by the ring
+/// buffer of each thread.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetTraceSampling(
+    TRITONSERVER_ServerOptions* options,
+    TRITONSERVER_InferenceTraceLevel level, uint32_t sample_rate,
+    uint32_t buffer_record_count);
+
+/// Set the callback that receives sampled trace records in a server
+/// options. Triton drains the ring buffers at the given interval, and
+/// whenever a buffer becomes half full, and delivers the records to
+/// 'records_fn' from a single background thread, so the callback does
+/// not need to be thread-safe with respect to itself.
+///
+/// \param options The server options object.
+/// \param records_fn The callback function, or nullptr to unset the
+/// callback so that records are retrieved with
+/// TRITONSERVER_ServerTraceRecords.
+/// \param records_userp User-provided pointer that is delivered to
+/// 'records_fn'.
+/// \param interval_ms The maximum interval, in milliseconds, between
+/// deliveries of pending records.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetTraceRecordsCallback(
+    TRITONSERVER_ServerOptions* options,
+    TRITONSERVER_InferenceTraceRecordsFn_t records_fn, void* records_userp,
+    uint64_t interval_ms);
+
 /// Set the directory containing backend shared libraries. This
 /// directory is searched last after the version and model directory
 /// in the model repository when looking for the backend shared
@@ -1514,6 +2541,18 @@ TRITONSERVER_ServerOptionsSetBackendConfig(
     const char* setting, const char* value);
 
 /// Set a host policy setting for a given policy name in a server options.
+/// The following settings are recognized:
+///
+///   "numa-node": The NUMA node, as a decimal integer, whose memory is
+///   used by the model instances of the policy. The instance threads
+///   are bound to the node's memory, and pinned buffers, including the
+///   staging buffers of TRITONBACKEND_InputBufferForHostPolicy, are
+///   allocated from the node's pinned memory pool, \see
+///   TRITONSERVER_ServerOptionsSetNumaPinnedMemoryPoolByteSize.
+///
+///   "cpu-cores": The CPU cores that the threads of the model instances
+///   of the policy are pinned to, as a comma-separated list of core
+///   numbers and inclusive ranges, for example "0-15,32-47".
 ///
 /// \param options The server options object.
 /// \param policy_name The name of the policy.
@@ -1525,6 +2564,23 @@ TRITONSERVER_ServerOptionsSetHostPolicy(
     TRITONSERVER_ServerOptions* options, const char* policy_name,
     const char* setting, const char* value);
 
+/// Enable or disable automatic NUMA host policies in a server options.
+/// When enabled, each model instance on a GPU that is not assigned a
+/// host policy in its model configuration is assigned the policy
+/// "gpu<N>", where N is the device id of the GPU. Unless set
+/// explicitly with TRITONSERVER_ServerOptionsSetHostPolicy, the
+/// "numa-node" and "cpu-cores" settings of the policy are the NUMA
+/// node and the CPU cores closest to the GPU as reported by the system
+/// topology. The default is disabled.
+///
+/// \param options The server options object.
+/// \param enable True to enable automatic NUMA host policies, false
+/// to disable.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetAutoNumaHostPolicy(
+    TRITONSERVER_ServerOptions* options, bool enable);
+
 /// TRITONSERVER_Server
 ///
 /// An inference server.
@@ -1575,7 +2631,8 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerStop(
     TRITONSERVER_Server* server);
 
 /// Check the model repository for changes and update server state
-/// based on those changes.
+/// based on those changes. How changes are detected depends on the
+/// poll mode, \see TRITONSERVER_ServerOptionsSetModelRepositoryPollMode.
 ///
 /// \param server The inference server object.
 /// \return a TRITONSERVER_Error indicating success or failure.
@@ -1674,7 +2731,9 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerMetadata(
 
 /// Get the metadata of a model as a TRITONSERVER_Message
 /// object.  The caller takes ownership of the message object and must
-/// call TRITONSERVER_MessageDelete to release the object.
+/// call TRITONSERVER_MessageDelete to release the object. The same
+/// information is available without parsing from the model
+/// configuration view, \see TRITONSERVER_ServerModelConfigView.
 ///
 /// \param server The inference server object.
 /// \param model_name The name of the model.
@@ -1691,6 +2750,26 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerModelMetadata(
 /// object. The caller takes ownership of the object and must call
 /// TRITONSERVER_MessageDelete to release the object.
 ///
+/// If latency histograms are enabled (\see
+/// TRITONSERVER_ServerOptionsSetLatencyHistograms) the "queue",
+/// "compute_input", "compute_infer" and "compute_output" statistics of
+/// the model, and of each of its instances, additionally hold a
+/// "histogram" object with the upper bound, in nanoseconds, and the
+/// count of each non-empty bucket.
+///
+/// If the response cache is enabled for the model the "cache_hit" and
+/// "cache_miss" statistics hold the count and total lookup duration of
+/// the cache lookups that did and did not find a cached response, and
+/// "cache_eviction_count" holds the number of responses of the model
+/// evicted from the cache.
+///
+/// If load-driven activation is enabled for the model (\see
+/// TRITONSERVER_ServerOptionsSetModelInstanceActivation)
+/// "instance_activation_count" and "instance_deactivation_count" hold
+/// the number of times a passive instance of the model was activated
+/// and deactivated, and "active_instance_count" holds the number of
+/// instances currently receiving requests.
+///
 /// \param server The inference server object.
 /// \param model_name The name of the model.
 /// If empty, then statistics for all available models will be returned,
@@ -1703,6 +2782,104 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerModelStatistics(
     TRITONSERVER_Server* server, const char* model_name,
     const int64_t model_version, TRITONSERVER_Message** model_stats);
 
+/// Statistics for one version of one model in a fixed layout, as
+/// returned by TRITONSERVER_ServerModelStatisticsSnapshot. The values
+/// are the same as those returned in the corresponding fields of the
+/// TRITONSERVER_ServerModelStatistics message. Durations are in
+/// nanoseconds. New fields are only ever added at the end of the
+/// structure.
+typedef struct tritonserver_modelstatisticsrecord_struct {
+  /// The name of the model. The string is owned by Triton and remains
+  /// valid for the lifetime of the server object.
+  const char* model_name;
+  int64_t model_version;
+  uint64_t last_inference_ms;
+  uint64_t inference_count;
+  uint64_t execution_count;
+  uint64_t success_count;
+  uint64_t success_ns;
+  uint64_t fail_count;
+  uint64_t fail_ns;
+  uint64_t queue_count;
+  uint64_t queue_ns;
+  uint64_t compute_input_count;
+  uint64_t compute_input_ns;
+  uint64_t compute_infer_count;
+  uint64_t compute_infer_ns;
+  uint64_t compute_output_count;
+  uint64_t compute_output_ns;
+  uint64_t cache_hit_count;
+  uint64_t cache_hit_ns;
+  uint64_t cache_miss_count;
+  uint64_t cache_miss_ns;
+  uint64_t cache_eviction_count;
+  uint64_t instance_activation_count;
+  uint64_t instance_deactivation_count;
+  uint64_t active_instance_count;
+} TRITONSERVER_ModelStatisticsRecord;
+
+/// Get the statistics of all available models in a caller-provided
+/// array of TRITONSERVER_ModelStatisticsRecord. Unlike
+/// TRITONSERVER_ServerModelStatistics this function does not allocate
+/// memory or format a message and so is suited to polling at high
+/// frequency.
+///
+/// Each call returns a snapshot token that identifies the state of
+/// the statistics at the time of the call. Passing that token as
+/// 'since_token' in a later call returns records only for the models
+/// whose statistics have changed since the earlier call. Passing 0 as
+/// 'since_token' returns records for all models. Models that have been
+/// unloaded since 'since_token' are not reported.
+///
+/// If 'records' has fewer than the required number of entries then
+/// TRITONSERVER_ERROR_UNAVAILABLE is returned, 'record_count' returns
+/// the required number of entries, the contents of 'records' are
+/// undefined and 'snapshot_token' is not updated, so the call can be
+/// repeated with a larger array and the same 'since_token'.
+///
+/// \param server The inference server object.
+/// \param since_token The snapshot token returned by an earlier call,
+/// or 0 to return records for all models.
+/// \param records The array to fill with statistics records.
+/// \param record_capacity The number of entries in 'records'.
+/// \param record_byte_size The size of each entry in 'records', in
+/// bytes. Must be set to sizeof(TRITONSERVER_ModelStatisticsRecord) so
+/// that a server supporting a later layout fills only the fields known
+/// to the caller.
+/// \param record_count Returns the number of records returned in
+/// 'records'.
+/// \param snapshot_token Returns the snapshot token for this call.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelStatisticsSnapshot(
+    TRITONSERVER_Server* server, const uint64_t since_token,
+    TRITONSERVER_ModelStatisticsRecord* records,
+    const uint32_t record_capacity, const size_t record_byte_size,
+    uint32_t* record_count, uint64_t* snapshot_token);
+
+/// Retrieve pending sampled trace records. Records are returned in
+/// timestamp order for each thread, but records recorded on different
+/// threads may be interleaved in any order. Returned records are
+/// removed from the ring buffers. If a records callback is set with
+/// TRITONSERVER_ServerOptionsSetTraceRecordsCallback then
+/// TRITONSERVER_ERROR_UNAVAILABLE is returned.
+///
+/// \param server The inference server object.
+/// \param records The array to fill with trace records.
+/// \param record_capacity The number of entries in 'records'.
+/// \param record_byte_size The size of each entry in 'records', in
+/// bytes. Must be set to sizeof(TRITONSERVER_InferenceTraceRecord).
+/// \param record_count Returns the number of records returned in
+/// 'records'. If equal to 'record_capacity' more records may be
+/// pending.
+/// \param dropped_count Returns the number of records that were
+/// overwritten before they could be retrieved since the previous call.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerTraceRecords(
+    TRITONSERVER_Server* server, TRITONSERVER_InferenceTraceRecord* records,
+    const uint32_t record_capacity, const size_t record_byte_size,
+    uint32_t* record_count, uint64_t* dropped_count);
+
 /// Get the configuration of a model as a TRITONSERVER_Message object.
 /// The caller takes ownership of the message object and must call
 /// TRITONSERVER_MessageDelete to release the object.
@@ -1722,6 +2899,24 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerModelConfig(
     const int64_t model_version, const uint32_t config_version,
     TRITONSERVER_Message** model_config);
 
+/// Get the configuration of a loaded model as a read-only
+/// TRITONSERVER_ModelConfigView. The call acquires a reference to the
+/// view shared by all users of the model and does not copy or format
+/// the configuration. The caller must call
+/// TRITONSERVER_ModelConfigViewRelease to release the reference. The
+/// view remains valid until released, even if the model is unloaded
+/// in the meantime.
+///
+/// \param server The inference server object.
+/// \param model_name The name of the model.
+/// \param model_version The version of the model.  If -1 then the
+/// server will choose a version based on the model's policy.
+/// \param view Returns the model configuration view.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerModelConfigView(
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version, TRITONSERVER_ModelConfigView** view);
+
 /// Get the index of all unique models in the model repositories as a
 /// TRITONSERVER_Message object. The caller takes ownership of the
 /// message object and must call TRITONSERVER_MessageDelete to release
@@ -1789,6 +2984,44 @@ TRITONSERVER_ServerUnloadModelAndDependents(
 TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerMetrics(
     TRITONSERVER_Server* server, TRITONSERVER_Metrics** metrics);
 
+/// Register a memory region with the server. The caller takes
+/// ownership of the returned TRITONSERVER_MemoryRegion object and
+/// must call TRITONSERVER_ServerUnregisterMemoryRegion to release the
+/// object. The memory described by the registration remains owned by
+/// the caller, who must not free or unmap it until the region is
+/// unregistered.
+///
+/// \param server The inference server object.
+/// \param region Returns the new memory region object.
+/// \param kind The kind of memory region. \see
+/// TRITONSERVER_MemoryRegionKind for the interpretation of 'base'.
+/// \param base The base address of the region or, for
+/// TRITONSERVER_MEMORY_REGION_CUDA_IPC, a pointer to the IPC handle.
+/// \param byte_size The size of the region, in bytes.
+/// \param memory_type_id The memory type ID of the region. For
+/// TRITONSERVER_MEMORY_REGION_CUDA_IPC this is the GPU device that
+/// holds the memory, otherwise it must be 0.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerRegisterMemoryRegion(
+    TRITONSERVER_Server* server, TRITONSERVER_MemoryRegion** region,
+    const TRITONSERVER_MemoryRegionKind kind, const void* base,
+    const size_t byte_size, const int64_t memory_type_id);
+
+/// Unregister a memory region and delete the region object. Returns
+/// TRITONSERVER_ERROR_UNAVAILABLE, and leaves the region registered,
+/// if the region is still referenced by the input data or requested
+/// outputs of an inference request, or by a response that has not been
+/// deleted. A request references the region until the input data or
+/// requested output is removed or the request is deleted.
+///
+/// \param server The inference server object.
+/// \param region The memory region object.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerUnregisterMemoryRegion(
+    TRITONSERVER_Server* server, TRITONSERVER_MemoryRegion* region);
+
 /// Perform inference using the meta-data and inputs supplied by the
 /// 'inference_request'. If the function returns success, then the
 /// caller releases ownership of 'inference_request' and must not
@@ -1815,6 +3048,44 @@ TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerInferAsync(
     TRITONSERVER_InferenceRequest* inference_request,
     TRITONSERVER_InferenceTrace* trace);
 
+/// Perform inference for a batch of requests using the meta-data and
+/// inputs supplied by each request in 'inference_requests'. This is
+/// equivalent to calling TRITONSERVER_ServerInferAsync for each
+/// request except that all requests are enqueued into the model's
+/// scheduler together, so the scheduler (for example, the dynamic
+/// batcher) observes the entire set of requests at once instead of
+/// one at a time. All requests must target the same model and model
+/// version, otherwise TRITONSERVER_ERROR_INVALID_ARG is returned.
+///
+/// The submission is all-or-nothing. If the function returns success,
+/// then the caller releases ownership of every request in
+/// 'inference_requests' and must not access any of them in any way
+/// after this call, until ownership of each is returned via the
+/// 'request_release_fn' callback registered in that request object
+/// with TRITONSERVER_InferenceRequestSetReleaseCallback. If the
+/// function returns an error then no request was enqueued and the
+/// caller retains ownership of all of them.
+///
+/// As with TRITONSERVER_ServerInferAsync, the function unconditionally
+/// takes ownership of every non-nullptr trace in 'traces'.
+///
+/// Responses produced for each request are returned using the
+/// allocator and callback registered with that request by
+/// TRITONSERVER_InferenceRequestSetResponseCallback.
+///
+/// \param server The inference server object.
+/// \param inference_requests The request objects.
+/// \param request_count The number of requests in 'inference_requests'.
+/// \param traces The trace objects for the requests, or nullptr if no
+/// tracing. If non-nullptr, must hold 'request_count' entries where
+/// entry i is the trace object for 'inference_requests[i]', or
+/// nullptr if that request is not traced.
+/// \return a TRITONSERVER_Error indicating success or failure.
+TRITONSERVER_DECLSPEC TRITONSERVER_Error* TRITONSERVER_ServerInferAsyncBatch(
+    TRITONSERVER_Server* server,
+    TRITONSERVER_InferenceRequest** inference_requests,
+    const uint32_t request_count, TRITONSERVER_InferenceTrace** traces);
+
 
 #ifdef __cplusplus
 }
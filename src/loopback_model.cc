@@ -0,0 +1,209 @@
+// Copyright 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "loopback_server.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+namespace triton { namespace core { namespace loopback {
+
+namespace {
+
+// Produce the outputs of one request into 'response', returning the
+// time the compute of the request started and ended.
+TRITONSERVER_Error*
+IdentityRequest(
+    const ModelConfig* config, TRITONBACKEND_Request* request,
+    TRITONBACKEND_Response* response, uint64_t* compute_start_ns,
+    uint64_t* compute_end_ns)
+{
+  const uint32_t slot_count = config->InputNames().size();
+
+  std::vector<TRITONBACKEND_Input*> inputs(slot_count, nullptr);
+  for (uint32_t slot = 0; slot < slot_count; ++slot) {
+    bool requested;
+    RETURN_IF_ERROR(
+        TRITONBACKEND_RequestOutputRequestedBySlot(request, slot, &requested));
+    if (requested) {
+      RETURN_IF_ERROR(
+          TRITONBACKEND_RequestInputBySlot(request, slot, &inputs[slot]));
+    }
+  }
+
+  *compute_start_ns = NowNs();
+  if (config->ComputeDelayUs() > 0) {
+    std::this_thread::sleep_for(
+        std::chrono::microseconds(config->ComputeDelayUs()));
+  }
+  *compute_end_ns = NowNs();
+
+  for (uint32_t slot = 0; slot < slot_count; ++slot) {
+    TRITONBACKEND_Input* input = inputs[slot];
+    if (input == nullptr) {
+      continue;
+    }
+
+    TRITONSERVER_DataType datatype;
+    const int64_t* shape;
+    uint32_t dims_count;
+    uint64_t byte_size;
+    uint32_t buffer_count;
+    RETURN_IF_ERROR(TRITONBACKEND_InputProperties(
+        input, nullptr /* name */, &datatype, &shape, &dims_count, &byte_size,
+        &buffer_count));
+
+    // With a fixed output size the output is a UINT8 vector holding the
+    // leading input bytes, zero padded.
+    uint64_t output_byte_size = byte_size;
+    if (config->OutputByteSize() > 0) {
+      datatype = config->OutputDataType();
+      shape = config->OutputShape();
+      dims_count = 1;
+      output_byte_size = config->OutputByteSize();
+    }
+
+    TRITONBACKEND_Output* output;
+    RETURN_IF_ERROR(TRITONBACKEND_ResponseOutputBySlot(
+        response, &output, slot, datatype, shape, dims_count));
+
+    // A BYTES output is a copy of the input, so read the input in the
+    // layout the output is returned in.
+    if (datatype == TRITONSERVER_TYPE_BYTES) {
+      TRITONSERVER_BytesLayout layout;
+      RETURN_IF_ERROR(TRITONBACKEND_OutputBytesLayout(output, &layout));
+      RETURN_IF_ERROR(TRITONBACKEND_InputSetBytesLayout(input, layout));
+      RETURN_IF_ERROR(TRITONBACKEND_InputProperties(
+          input, nullptr /* name */, nullptr /* datatype */,
+          nullptr /* shape */, nullptr /* dims_count */, &byte_size,
+          &buffer_count));
+      output_byte_size = byte_size;
+    }
+
+    void* output_buffer;
+    TRITONSERVER_MemoryType output_memory_type = TRITONSERVER_MEMORY_CPU;
+    int64_t output_memory_type_id = 0;
+    RETURN_IF_ERROR(TRITONBACKEND_OutputBuffer(
+        output, &output_buffer, output_byte_size, &output_memory_type,
+        &output_memory_type_id));
+    if (output_memory_type == TRITONSERVER_MEMORY_GPU) {
+      return TRITONSERVER_ErrorNew(
+          TRITONSERVER_ERROR_UNSUPPORTED,
+          "output buffers in GPU memory are not supported by the loopback "
+          "server");
+    }
+
+    char* dst = reinterpret_cast<char*>(output_buffer);
+    uint64_t remaining = output_byte_size;
+    for (uint32_t b = 0; (b < buffer_count) && (remaining > 0); ++b) {
+      const void* input_buffer;
+      uint64_t input_byte_size;
+      TRITONSERVER_MemoryType input_memory_type;
+      int64_t input_memory_type_id;
+      RETURN_IF_ERROR(TRITONBACKEND_InputBuffer(
+          input, b, &input_buffer, &input_byte_size, &input_memory_type,
+          &input_memory_type_id));
+
+      const uint64_t copy_byte_size = std::min(input_byte_size, remaining);
+      memcpy(dst, input_buffer, copy_byte_size);
+      dst += copy_byte_size;
+      remaining -= copy_byte_size;
+    }
+    if (remaining > 0) {
+      memset(dst, 0, remaining);
+    }
+  }
+
+  return nullptr;
+}
+
+}  // namespace
+
+TRITONSERVER_Error*
+IdentityModelExecute(
+    TRITONBACKEND_ModelInstance* instance, TRITONBACKEND_Request** requests,
+    const uint32_t request_count)
+{
+  TRITONBACKEND_Model* model;
+  RETURN_IF_ERROR(TRITONBACKEND_ModelInstanceModel(instance, &model));
+  void* state;
+  RETURN_IF_ERROR(TRITONBACKEND_ModelState(model, &state));
+  const ModelConfig* config = reinterpret_cast<const ModelConfig*>(state);
+
+  // Each request is executed, responded to and released in turn so
+  // that a failure of one request does not affect the others.
+  for (uint32_t r = 0; r < request_count; ++r) {
+    TRITONBACKEND_Request* request = requests[r];
+    const uint64_t exec_start_ns = NowNs();
+    uint64_t compute_start_ns = exec_start_ns;
+    uint64_t compute_end_ns = exec_start_ns;
+
+    TRITONBACKEND_Response* response;
+    TRITONSERVER_Error* err = TRITONBACKEND_ResponseNew(&response, request);
+    if (err == nullptr) {
+      err = IdentityRequest(
+          config, request, response, &compute_start_ns, &compute_end_ns);
+      TRITONSERVER_Error* send_err = TRITONBACKEND_ResponseSend(
+          response, TRITONSERVER_RESPONSE_COMPLETE_FINAL, err);
+      if (send_err != nullptr) {
+        Logger::Log(
+            TRITONSERVER_LOG_ERROR, __FILE__, __LINE__,
+            TRITONSERVER_ErrorMessage(send_err));
+        TRITONSERVER_ErrorDelete(send_err);
+      }
+    }
+    const uint64_t exec_end_ns = NowNs();
+
+    TRITONSERVER_Error* stats_err = TRITONBACKEND_ModelInstanceReportStatistics(
+        instance, request, (err == nullptr), exec_start_ns, compute_start_ns,
+        compute_end_ns, exec_end_ns);
+    if (stats_err != nullptr) {
+      TRITONSERVER_ErrorDelete(stats_err);
+    }
+    if (err != nullptr) {
+      TRITONSERVER_ErrorDelete(err);
+    }
+
+    TRITONSERVER_Error* release_err =
+        TRITONBACKEND_RequestRelease(request, TRITONSERVER_REQUEST_RELEASE_ALL);
+    if (release_err != nullptr) {
+      TRITONSERVER_ErrorDelete(release_err);
+    }
+
+    stats_err = TRITONBACKEND_ModelInstanceReportBatchStatistics(
+        instance, 1 /* batch_size */, exec_start_ns, compute_start_ns,
+        compute_end_ns, exec_end_ns);
+    if (stats_err != nullptr) {
+      TRITONSERVER_ErrorDelete(stats_err);
+    }
+  }
+
+  return nullptr;
+}
+
+}}}  // namespace triton::core::loopback
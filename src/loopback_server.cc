@@ -0,0 +1,1954 @@
+// Copyright 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include "loopback_server.h"
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+
+namespace triton { namespace core { namespace loopback {
+
+namespace {
+
+void
+AppendJsonString(std::string* json, const std::string& str)
+{
+  json->push_back('"');
+  for (const char c : str) {
+    switch (c) {
+      case '"':
+        json->append("\\\"");
+        break;
+      case '\\':
+        json->append("\\\\");
+        break;
+      case '\n':
+        json->append("\\n");
+        break;
+      case '\t':
+        json->append("\\t");
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          json->append(escaped);
+        } else {
+          json->push_back(c);
+        }
+    }
+  }
+  json->push_back('"');
+}
+
+void
+AppendJsonDuration(
+    std::string* json, const char* name, const StatDuration& duration)
+{
+  AppendJsonString(json, name);
+  json->append(":{\"count\":");
+  json->append(std::to_string(duration.count_));
+  json->append(",\"ns\":");
+  json->append(std::to_string(duration.ns_));
+  json->append("}");
+}
+
+void
+AppendJsonTensor(
+    std::string* json, const char* datatype_key, const std::string& name,
+    const std::string& datatype, const char* shape_key, const int64_t dim,
+    const bool optional)
+{
+  json->append("{\"name\":");
+  AppendJsonString(json, name);
+  json->append(",");
+  AppendJsonString(json, datatype_key);
+  json->append(":");
+  AppendJsonString(json, datatype);
+  json->append(",");
+  AppendJsonString(json, shape_key);
+  json->append(":[");
+  json->append(std::to_string(dim));
+  json->append("]");
+  if (optional) {
+    json->append(",\"optional\":true");
+  }
+  json->append("}");
+}
+
+void
+AppendPrometheusMetric(
+    std::string* text, const char* name, const char* help, const char* type,
+    const std::string& labels, const uint64_t value)
+{
+  text->append("# HELP ").append(name).append(" ").append(help).append("\n");
+  text->append("# TYPE ").append(name).append(" ").append(type).append("\n");
+  text->append(name).append(labels).append(" ");
+  text->append(std::to_string(value)).append("\n");
+}
+
+TRITONSERVER_Error*
+ParseUnsigned(
+    const std::map<std::string, std::string>& settings, const char* name,
+    const uint64_t default_value, uint64_t* value)
+{
+  const auto itr = settings.find(name);
+  if (itr == settings.end()) {
+    *value = default_value;
+    return nullptr;
+  }
+
+  const char* str = itr->second.c_str();
+  char* end = nullptr;
+  errno = 0;
+  const unsigned long long parsed = strtoull(str, &end, 10);
+  if ((errno != 0) || (end == str) || (*end != '\0') || (str[0] == '-')) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "unable to parse loopback backend setting '" + std::string(name) +
+            "' value '" + itr->second + "' as an unsigned integer");
+  }
+
+  *value = parsed;
+  return nullptr;
+}
+
+uint64_t
+Elapsed(const uint64_t start_ns, const uint64_t end_ns)
+{
+  return (end_ns > start_ns) ? (end_ns - start_ns) : 0;
+}
+
+}  // namespace
+
+uint64_t
+NowNs()
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+TRITONSERVER_Error*
+ConvertBytesLayout(
+    const TRITONSERVER_BytesLayout src_layout, const char* src,
+    const size_t src_byte_size, const uint64_t element_count,
+    const TRITONSERVER_BytesLayout dst_layout, char* dst,
+    const size_t dst_byte_size, size_t* converted_byte_size)
+{
+  const std::string malformed =
+      std::string("BYTES data is not a valid ") +
+      TRITONSERVER_BytesLayoutString(src_layout) + " encoding of " +
+      std::to_string(element_count) + " elements";
+
+  // Locate the elements of the source, validating its encoding.
+  std::vector<std::pair<const char*, uint64_t>> elements;
+  uint64_t data_byte_size = 0;
+  if (src_layout == TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED) {
+    if (element_count > (src_byte_size / sizeof(uint32_t))) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG, malformed);
+    }
+    elements.reserve(element_count);
+    size_t offset = 0;
+    for (uint64_t e = 0; e < element_count; ++e) {
+      uint32_t length;
+      if ((src_byte_size - offset) < sizeof(length)) {
+        return TritonServerError::Create(
+            TRITONSERVER_ERROR_INVALID_ARG, malformed);
+      }
+      memcpy(&length, src + offset, sizeof(length));
+      offset += sizeof(length);
+      if ((src_byte_size - offset) < length) {
+        return TritonServerError::Create(
+            TRITONSERVER_ERROR_INVALID_ARG, malformed);
+      }
+      elements.emplace_back(src + offset, length);
+      offset += length;
+      data_byte_size += length;
+    }
+    if (offset != src_byte_size) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG, malformed);
+    }
+  } else if (src_layout == TRITONSERVER_BYTES_LAYOUT_OFFSETS) {
+    if (element_count >= (src_byte_size / sizeof(uint64_t))) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG, malformed);
+    }
+    elements.reserve(element_count);
+    const size_t offsets_byte_size = (element_count + 1) * sizeof(uint64_t);
+    const char* data = src + offsets_byte_size;
+    data_byte_size = src_byte_size - offsets_byte_size;
+
+    uint64_t begin;
+    memcpy(&begin, src, sizeof(begin));
+    if (begin != 0) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG, malformed);
+    }
+    for (uint64_t e = 0; e < element_count; ++e) {
+      uint64_t end;
+      memcpy(&end, src + (e + 1) * sizeof(end), sizeof(end));
+      if ((end < begin) || (end > data_byte_size)) {
+        return TritonServerError::Create(
+            TRITONSERVER_ERROR_INVALID_ARG, malformed);
+      }
+      elements.emplace_back(data + begin, end - begin);
+      begin = end;
+    }
+    if (begin != data_byte_size) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG, malformed);
+    }
+  } else {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG, "unknown BYTES layout");
+  }
+
+  size_t byte_size;
+  if (dst_layout == TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED) {
+    byte_size = element_count * sizeof(uint32_t) + data_byte_size;
+  } else if (dst_layout == TRITONSERVER_BYTES_LAYOUT_OFFSETS) {
+    byte_size = (element_count + 1) * sizeof(uint64_t) + data_byte_size;
+  } else {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG, "unknown BYTES layout");
+  }
+
+  *converted_byte_size = byte_size;
+  if (dst == nullptr) {
+    return nullptr;
+  }
+  if (dst_byte_size < byte_size) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "converted BYTES data requires " + std::to_string(byte_size) +
+            " bytes but the buffer has " + std::to_string(dst_byte_size));
+  }
+
+  if (dst_layout == TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED) {
+    for (const auto& element : elements) {
+      if (element.second > UINT32_MAX) {
+        return TritonServerError::Create(
+            TRITONSERVER_ERROR_INVALID_ARG,
+            "BYTES element of " + std::to_string(element.second) +
+                " bytes cannot be length prefixed");
+      }
+      const uint32_t length = element.second;
+      memcpy(dst, &length, sizeof(length));
+      dst += sizeof(length);
+      memcpy(dst, element.first, length);
+      dst += length;
+    }
+  } else {
+    char* data = dst + (element_count + 1) * sizeof(uint64_t);
+    uint64_t offset = 0;
+    memcpy(dst, &offset, sizeof(offset));
+    for (uint64_t e = 0; e < element_count; ++e) {
+      memcpy(data + offset, elements[e].first, elements[e].second);
+      offset += elements[e].second;
+      memcpy(dst + (e + 1) * sizeof(offset), &offset, sizeof(offset));
+    }
+  }
+
+  return nullptr;
+}
+
+//
+// TritonServerError
+//
+TRITONSERVER_Error*
+TritonServerError::Create(TRITONSERVER_Error_Code code, const std::string& msg)
+{
+  return reinterpret_cast<TRITONSERVER_Error*>(
+      new TritonServerError(code, msg));
+}
+
+//
+// Logger
+//
+std::atomic<bool> Logger::info_(true);
+std::atomic<bool> Logger::warn_(true);
+std::atomic<bool> Logger::error_(true);
+std::atomic<int> Logger::verbose_(0);
+std::mutex Logger::mu_;
+
+bool
+Logger::IsEnabled(TRITONSERVER_LogLevel level)
+{
+  switch (level) {
+    case TRITONSERVER_LOG_INFO:
+      return info_.load(std::memory_order_relaxed);
+    case TRITONSERVER_LOG_WARN:
+      return warn_.load(std::memory_order_relaxed);
+    case TRITONSERVER_LOG_ERROR:
+      return error_.load(std::memory_order_relaxed);
+    case TRITONSERVER_LOG_VERBOSE:
+      return verbose_.load(std::memory_order_relaxed) > 0;
+  }
+
+  return false;
+}
+
+void
+Logger::SetEnabled(TRITONSERVER_LogLevel level, bool enable)
+{
+  switch (level) {
+    case TRITONSERVER_LOG_INFO:
+      info_.store(enable);
+      break;
+    case TRITONSERVER_LOG_WARN:
+      warn_.store(enable);
+      break;
+    case TRITONSERVER_LOG_ERROR:
+      error_.store(enable);
+      break;
+    case TRITONSERVER_LOG_VERBOSE:
+      verbose_.store(enable ? 1 : 0);
+      break;
+  }
+}
+
+void
+Logger::SetVerboseLevel(int level)
+{
+  verbose_.store(level);
+}
+
+void
+Logger::Log(
+    TRITONSERVER_LogLevel level, const char* filename, const int line,
+    const char* msg)
+{
+  static const char kLevelChar[] = {'I', 'W', 'E', 'V'};
+
+  const auto now = std::chrono::system_clock::now();
+  const time_t now_sec = std::chrono::system_clock::to_time_t(now);
+  const uint64_t now_us =
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          now.time_since_epoch())
+          .count() %
+      1000000;
+  struct tm tm_time;
+#ifdef _WIN32
+  localtime_s(&tm_time, &now_sec);
+#else
+  localtime_r(&now_sec, &tm_time);
+#endif
+
+  const char* basename = strrchr(filename, '/');
+  basename = (basename == nullptr) ? filename : basename + 1;
+
+  std::lock_guard<std::mutex> lock(mu_);
+  fprintf(
+      stderr, "%c%02d%02d %02d:%02d:%02d.%06llu %s:%d] %s\n",
+      kLevelChar[level], tm_time.tm_mon + 1, tm_time.tm_mday,
+      tm_time.tm_hour, tm_time.tm_min, tm_time.tm_sec,
+      static_cast<unsigned long long>(now_us), basename, line, msg);
+}
+
+//
+// ServerOptions
+//
+ServerOptions::ServerOptions()
+    : server_id_("triton"), log_info_(true), log_warn_(true),
+      log_error_(true), log_verbose_(0), metrics_(true),
+      strict_readiness_(true),
+      model_control_mode_(TRITONSERVER_MODEL_CONTROL_NONE)
+{
+}
+
+//
+// ModelConfig
+//
+TRITONSERVER_Error*
+ModelConfig::Create(
+    const std::map<std::string, std::string>& settings, ModelConfig** config)
+{
+  static const char* kSettings[] = {"model-name",       "input-count",
+                                    "datatype",         "compute-delay-us",
+                                    "output-byte-size", "instance-count"};
+  for (const auto& setting : settings) {
+    bool known = false;
+    for (const char* name : kSettings) {
+      known |= (setting.first == name);
+    }
+    if (!known) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG,
+          "unknown loopback backend setting '" + setting.first + "'");
+    }
+  }
+
+  std::unique_ptr<ModelConfig> lconfig(new ModelConfig());
+
+  const auto name_itr = settings.find("model-name");
+  lconfig->name_ =
+      (name_itr == settings.end()) ? "loopback" : name_itr->second;
+  if (lconfig->name_.empty()) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "loopback backend setting 'model-name' must not be empty");
+  }
+
+  lconfig->datatype_ = TRITONSERVER_TYPE_UINT8;
+  const auto datatype_itr = settings.find("datatype");
+  if (datatype_itr != settings.end()) {
+    lconfig->datatype_ =
+        TRITONSERVER_StringToDataType(datatype_itr->second.c_str());
+    if (lconfig->datatype_ == TRITONSERVER_TYPE_INVALID) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG,
+          "unknown datatype '" + datatype_itr->second +
+              "' for loopback backend setting 'datatype'");
+    }
+  }
+
+  uint64_t input_count, instance_count;
+  RETURN_IF_ERROR(ParseUnsigned(settings, "input-count", 1, &input_count));
+  RETURN_IF_ERROR(ParseUnsigned(
+      settings, "compute-delay-us", 0, &lconfig->compute_delay_us_));
+  RETURN_IF_ERROR(ParseUnsigned(
+      settings, "output-byte-size", 0, &lconfig->output_byte_size_));
+  RETURN_IF_ERROR(
+      ParseUnsigned(settings, "instance-count", 1, &instance_count));
+  if ((input_count == 0) || (input_count > UINT32_MAX)) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "loopback backend setting 'input-count' must be in the range [1, " +
+            std::to_string(UINT32_MAX) + "]");
+  }
+  if ((instance_count == 0) || (instance_count > UINT32_MAX)) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "loopback backend setting 'instance-count' must be in the range "
+        "[1, " +
+            std::to_string(UINT32_MAX) + "]");
+  }
+  lconfig->instance_count_ = instance_count;
+
+  for (uint64_t i = 0; i < input_count; ++i) {
+    lconfig->input_names_.emplace_back("INPUT" + std::to_string(i));
+    lconfig->output_names_.emplace_back("OUTPUT" + std::to_string(i));
+  }
+
+  if (lconfig->output_byte_size_ == 0) {
+    lconfig->output_datatype_ = lconfig->datatype_;
+    lconfig->output_shape_ = -1;
+  } else {
+    lconfig->output_datatype_ = TRITONSERVER_TYPE_UINT8;
+    lconfig->output_shape_ = lconfig->output_byte_size_;
+  }
+
+  *config = lconfig.release();
+  return nullptr;
+}
+
+void
+ModelConfig::Release()
+{
+  if (refcount_.fetch_sub(1) == 1) {
+    delete this;
+  }
+}
+
+//
+// MemoryRegion
+//
+void
+MemoryRegion::Release()
+{
+  if (refcount_.fetch_sub(1) == 1) {
+    delete this;
+  }
+}
+
+bool
+MemoryRegion::ReleaseIfUnused()
+{
+  uint32_t expected = 1;
+  if (!refcount_.compare_exchange_strong(expected, 0)) {
+    return false;
+  }
+
+  delete this;
+  return true;
+}
+
+namespace {
+
+bool
+FindSlot(
+    const char* name, const char* prefix, const std::vector<std::string>& names,
+    uint32_t* slot)
+{
+  // The names are the prefix followed by the slot, so the slot can be
+  // parsed from the name instead of searched for.
+  const size_t prefix_len = strlen(prefix);
+  if (strncmp(name, prefix, prefix_len) != 0) {
+    return false;
+  }
+
+  const char* digits = name + prefix_len;
+  char* end = nullptr;
+  const unsigned long idx = strtoul(digits, &end, 10);
+  if ((end == digits) || (*end != '\0') || (idx >= names.size()) ||
+      (names[idx] != name)) {
+    return false;
+  }
+
+  *slot = idx;
+  return true;
+}
+
+}  // namespace
+
+bool
+ModelConfig::InputSlot(const char* name, uint32_t* slot) const
+{
+  return FindSlot(name, "INPUT", input_names_, slot);
+}
+
+bool
+ModelConfig::OutputSlot(const char* name, uint32_t* slot) const
+{
+  return FindSlot(name, "OUTPUT", output_names_, slot);
+}
+
+std::string
+ModelConfig::ConfigJson() const
+{
+  const std::string input_datatype =
+      std::string("TYPE_") + TRITONSERVER_DataTypeString(datatype_);
+  const std::string output_datatype =
+      std::string("TYPE_") + TRITONSERVER_DataTypeString(output_datatype_);
+
+  std::string json("{\"name\":");
+  AppendJsonString(&json, name_);
+  json.append(
+      ",\"platform\":\"\",\"backend\":\"loopback\","
+      "\"version_policy\":{\"latest\":{\"num_versions\":1}},"
+      "\"max_batch_size\":0,\"input\":[");
+  for (size_t i = 0; i < input_names_.size(); ++i) {
+    if (i > 0) {
+      json.append(",");
+    }
+    AppendJsonTensor(
+        &json, "data_type", input_names_[i], input_datatype, "dims",
+        input_shape_, true /* optional */);
+  }
+  json.append("],\"output\":[");
+  for (size_t i = 0; i < output_names_.size(); ++i) {
+    if (i > 0) {
+      json.append(",");
+    }
+    AppendJsonTensor(
+        &json, "data_type", output_names_[i], output_datatype, "dims",
+        output_shape_, false /* optional */);
+  }
+  json.append("],\"instance_group\":[{\"name\":");
+  AppendJsonString(&json, name_);
+  json.append(",\"kind\":\"KIND_CPU\",\"count\":");
+  json.append(std::to_string(instance_count_));
+  json.append("}],\"parameters\":{\"compute-delay-us\":{\"string_value\":");
+  AppendJsonString(&json, std::to_string(compute_delay_us_));
+  json.append("},\"output-byte-size\":{\"string_value\":");
+  AppendJsonString(&json, std::to_string(output_byte_size_));
+  json.append("}}}");
+  return json;
+}
+
+std::string
+ModelConfig::MetadataJson() const
+{
+  const std::string input_datatype = TRITONSERVER_DataTypeString(datatype_);
+  const std::string output_datatype =
+      TRITONSERVER_DataTypeString(output_datatype_);
+
+  std::string json("{\"name\":");
+  AppendJsonString(&json, name_);
+  json.append(",\"versions\":[\"1\"],\"platform\":\"loopback\",\"inputs\":[");
+  for (size_t i = 0; i < input_names_.size(); ++i) {
+    if (i > 0) {
+      json.append(",");
+    }
+    AppendJsonTensor(
+        &json, "datatype", input_names_[i], input_datatype, "shape",
+        input_shape_, false /* optional */);
+  }
+  json.append("],\"outputs\":[");
+  for (size_t i = 0; i < output_names_.size(); ++i) {
+    if (i > 0) {
+      json.append(",");
+    }
+    AppendJsonTensor(
+        &json, "datatype", output_names_[i], output_datatype, "shape",
+        output_shape_, false /* optional */);
+  }
+  json.append("]}");
+  return json;
+}
+
+//
+// InferenceRequest::Input
+//
+InferenceRequest::Input::Input(
+    const std::string& name, const TRITONSERVER_DataType datatype,
+    const int64_t* shape, const uint64_t dim_count)
+    : name_(name), datatype_(datatype), shape_(shape, shape + dim_count),
+      byte_size_(0), bytes_layout_(TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED),
+      converted_(false)
+{
+}
+
+InferenceRequest::Input::~Input()
+{
+  RemoveAllData();
+}
+
+TRITONSERVER_Error*
+InferenceRequest::Input::AppendData(
+    const void* base, size_t byte_size, TRITONSERVER_MemoryType memory_type,
+    int64_t memory_type_id)
+{
+  if (memory_type == TRITONSERVER_MEMORY_GPU) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_UNSUPPORTED,
+        "input '" + name_ + "' data in GPU memory is not supported by the "
+                            "loopback server");
+  }
+
+  if (byte_size > 0) {
+    buffers_.push_back(Buffer{base, byte_size, memory_type, memory_type_id});
+    byte_size_ += byte_size;
+  }
+
+  return nullptr;
+}
+
+void
+InferenceRequest::Input::RemoveAllData()
+{
+  buffers_.clear();
+  byte_size_ = 0;
+  converted_ = false;
+  converted_data_.clear();
+  converted_buffers_.clear();
+  for (InferenceResponse* response : held_responses_) {
+    response->Release();
+  }
+  held_responses_.clear();
+  for (MemoryRegion* region : held_regions_) {
+    region->Release();
+  }
+  held_regions_.clear();
+}
+
+void
+InferenceRequest::Input::HoldResponse(InferenceResponse* response)
+{
+  response->AddRef();
+  held_responses_.push_back(response);
+}
+
+void
+InferenceRequest::Input::HoldRegion(MemoryRegion* region)
+{
+  region->AddRef();
+  held_regions_.push_back(region);
+}
+
+void
+InferenceRequest::Input::SetBytesLayout(const TRITONSERVER_BytesLayout layout)
+{
+  bytes_layout_ = layout;
+  converted_ = false;
+}
+
+TRITONSERVER_Error*
+InferenceRequest::Input::SetBackendBytesLayout(
+    const TRITONSERVER_BytesLayout layout)
+{
+  converted_ = false;
+  if (layout == bytes_layout_) {
+    return nullptr;
+  }
+
+  uint64_t element_count = 1;
+  for (const int64_t dim : shape_) {
+    if (dim < 0) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG,
+          "input '" + name_ + "' has a negative dimension");
+    }
+    element_count *= dim;
+  }
+
+  // The conversion needs the appended data in one block.
+  std::vector<char> data;
+  const char* src = nullptr;
+  if (buffers_.size() == 1) {
+    src = reinterpret_cast<const char*>(buffers_[0].base_);
+  } else {
+    data.reserve(byte_size_);
+    for (const auto& buffer : buffers_) {
+      const char* base = reinterpret_cast<const char*>(buffer.base_);
+      data.insert(data.end(), base, base + buffer.byte_size_);
+    }
+    src = data.data();
+  }
+
+  size_t converted_byte_size;
+  RETURN_IF_ERROR(ConvertBytesLayout(
+      bytes_layout_, src, byte_size_, element_count, layout,
+      nullptr /* dst */, 0, &converted_byte_size));
+  converted_data_.resize(converted_byte_size);
+  RETURN_IF_ERROR(ConvertBytesLayout(
+      bytes_layout_, src, byte_size_, element_count, layout,
+      converted_data_.data(), converted_data_.size(), &converted_byte_size));
+
+  converted_buffers_.assign(
+      1, Buffer{
+             converted_data_.data(), converted_data_.size(),
+             TRITONSERVER_MEMORY_CPU, 0 /* memory_type_id */});
+  converted_ = true;
+  return nullptr;
+}
+
+//
+// InferenceRequest
+//
+InferenceRequest::InferenceRequest(Server* server, Model* model)
+    : flags_(0), correlation_id_(0), correlation_id_is_string_(false),
+      priority_(0), timeout_us_(0), release_fn_(nullptr),
+      release_userp_(nullptr), allocator_(nullptr), allocator_userp_(nullptr),
+      response_fn_(nullptr), response_batch_fn_(nullptr),
+      response_userp_(nullptr), server_(server), model_(model),
+      queue_start_ns_(0)
+{
+}
+
+InferenceRequest::~InferenceRequest()
+{
+  RemoveAllRequestedOutputs();
+}
+
+InferenceRequest::Input*
+InferenceRequest::FindInput(const char* name) const
+{
+  for (const auto& input : inputs_) {
+    if (input->Name() == name) {
+      return input.get();
+    }
+  }
+
+  return nullptr;
+}
+
+TRITONSERVER_Error*
+InferenceRequest::AddInput(
+    const char* name, const TRITONSERVER_DataType datatype,
+    const int64_t* shape, const uint64_t dim_count)
+{
+  if (FindInput(name) != nullptr) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "input '" + std::string(name) + "' already exists in request");
+  }
+
+  inputs_.emplace_back(new Input(name, datatype, shape, dim_count));
+  return nullptr;
+}
+
+TRITONSERVER_Error*
+InferenceRequest::RemoveInput(const char* name)
+{
+  for (auto itr = inputs_.begin(); itr != inputs_.end(); ++itr) {
+    if ((*itr)->Name() == name) {
+      inputs_.erase(itr);
+      return nullptr;
+    }
+  }
+
+  return TritonServerError::Create(
+      TRITONSERVER_ERROR_INVALID_ARG,
+      "input '" + std::string(name) + "' does not exist in request");
+}
+
+void
+InferenceRequest::RemoveAllInputs()
+{
+  inputs_.clear();
+}
+
+void
+InferenceRequest::RemoveAllInputData()
+{
+  for (auto& input : inputs_) {
+    input->RemoveAllData();
+  }
+}
+
+TRITONSERVER_Error*
+InferenceRequest::AddRequestedOutput(const char* name)
+{
+  for (const auto& output : requested_outputs_) {
+    if (output.name_ == name) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG,
+          "output '" + std::string(name) + "' already requested");
+    }
+  }
+
+  requested_outputs_.push_back(RequestedOutput{
+      name, nullptr, 0, 0, TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED});
+  return nullptr;
+}
+
+TRITONSERVER_Error*
+InferenceRequest::SetRequestedOutputRegion(
+    const char* name, MemoryRegion* region, size_t offset,
+    size_t byte_size)
+{
+  if ((offset > region->byte_size_) ||
+      (byte_size > (region->byte_size_ - offset))) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "block for output '" + std::string(name) +
+            "' exceeds the size of the memory region");
+  }
+
+  for (auto& output : requested_outputs_) {
+    if (output.name_ == name) {
+      region->AddRef();
+      if (output.region_ != nullptr) {
+        output.region_->Release();
+      }
+      output.region_ = region;
+      output.offset_ = offset;
+      output.byte_size_ = byte_size;
+      return nullptr;
+    }
+  }
+
+  return TritonServerError::Create(
+      TRITONSERVER_ERROR_INVALID_ARG,
+      "output '" + std::string(name) + "' is not requested");
+}
+
+TRITONSERVER_Error*
+InferenceRequest::SetRequestedOutputBytesLayout(
+    const char* name, const TRITONSERVER_BytesLayout layout)
+{
+  for (auto& output : requested_outputs_) {
+    if (output.name_ == name) {
+      output.bytes_layout_ = layout;
+      return nullptr;
+    }
+  }
+
+  return TritonServerError::Create(
+      TRITONSERVER_ERROR_INVALID_ARG,
+      "output '" + std::string(name) + "' is not requested");
+}
+
+TRITONSERVER_Error*
+InferenceRequest::RemoveRequestedOutput(const char* name)
+{
+  for (auto itr = requested_outputs_.begin(); itr != requested_outputs_.end();
+       ++itr) {
+    if (itr->name_ == name) {
+      if (itr->region_ != nullptr) {
+        itr->region_->Release();
+      }
+      requested_outputs_.erase(itr);
+      return nullptr;
+    }
+  }
+
+  return TritonServerError::Create(
+      TRITONSERVER_ERROR_INVALID_ARG,
+      "output '" + std::string(name) + "' does not exist in request");
+}
+
+void
+InferenceRequest::RemoveAllRequestedOutputs()
+{
+  for (const auto& output : requested_outputs_) {
+    if (output.region_ != nullptr) {
+      output.region_->Release();
+    }
+  }
+  requested_outputs_.clear();
+}
+
+TRITONSERVER_Error*
+InferenceRequest::PrepareForInference()
+{
+  if ((response_fn_ == nullptr) && (response_batch_fn_ == nullptr)) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "inference request is missing response callback");
+  }
+  if (allocator_ == nullptr) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "inference request is missing response allocator");
+  }
+  if (release_fn_ == nullptr) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "inference request is missing release callback");
+  }
+
+  const ModelConfig* config = model_->Config();
+
+  slot_inputs_.assign(config->InputNames().size(), nullptr);
+  for (const auto& input : inputs_) {
+    uint32_t slot;
+    if (!config->InputSlot(input->Name().c_str(), &slot)) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG,
+          "unexpected inference input '" + input->Name() + "' for model '" +
+              config->Name() + "'");
+    }
+    if (input->DataType() != config->DataType()) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG,
+          "inference input '" + input->Name() + "' data-type is '" +
+              TRITONSERVER_DataTypeString(input->DataType()) +
+              "', model '" + config->Name() + "' expects '" +
+              TRITONSERVER_DataTypeString(config->DataType()) + "'");
+    }
+
+    uint64_t element_count = 1;
+    for (const int64_t dim : input->Shape()) {
+      if (dim < 0) {
+        return TritonServerError::Create(
+            TRITONSERVER_ERROR_INVALID_ARG,
+            "inference input '" + input->Name() +
+                "' has a negative dimension");
+      }
+      element_count *= dim;
+    }
+    // BYTES data is read by the backend in the length-prefixed layout
+    // unless the backend selects another, which also validates data
+    // appended in another layout.
+    if (input->DataType() == TRITONSERVER_TYPE_BYTES) {
+      RETURN_IF_ERROR(input->SetBackendBytesLayout(
+          TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED));
+    }
+
+    const uint32_t element_byte_size =
+        TRITONSERVER_DataTypeByteSize(input->DataType());
+    if ((element_byte_size != 0) &&
+        ((element_count * element_byte_size) != input->ByteSize())) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG,
+          "inference input '" + input->Name() + "' expects " +
+              std::to_string(element_count * element_byte_size) +
+              " bytes of data but got " + std::to_string(input->ByteSize()));
+    }
+
+    slot_inputs_[slot] = input.get();
+  }
+
+  slot_outputs_.assign(config->OutputNames().size(), nullptr);
+  for (const auto& output : requested_outputs_) {
+    uint32_t slot;
+    if (!config->OutputSlot(output.name_.c_str(), &slot)) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG,
+          "unexpected inference output '" + output.name_ + "' for model '" +
+              config->Name() + "'");
+    }
+    slot_outputs_[slot] = &output;
+  }
+
+  return nullptr;
+}
+
+InferenceRequest::Input*
+InferenceRequest::SlotInput(const uint32_t slot) const
+{
+  return (slot < slot_inputs_.size()) ? slot_inputs_[slot] : nullptr;
+}
+
+bool
+InferenceRequest::SlotOutputRequested(const uint32_t slot) const
+{
+  if (slot >= slot_outputs_.size()) {
+    return false;
+  }
+
+  // A request that names no outputs requests all outputs.
+  return requested_outputs_.empty() || (slot_outputs_[slot] != nullptr);
+}
+
+const InferenceRequest::RequestedOutput*
+InferenceRequest::SlotRequestedOutput(const uint32_t slot) const
+{
+  return (slot < slot_outputs_.size()) ? slot_outputs_[slot] : nullptr;
+}
+
+void
+InferenceRequest::Release(const uint32_t release_flags)
+{
+  release_fn_(
+      reinterpret_cast<TRITONSERVER_InferenceRequest*>(this), release_flags,
+      release_userp_);
+}
+
+//
+// InferenceResponse::Output
+//
+InferenceResponse::Output::Output(
+    InferenceResponse* response, const std::string& name,
+    const TRITONSERVER_DataType datatype, const int64_t* shape,
+    const uint32_t dims_count,
+    const InferenceRequest::RequestedOutput* requested)
+    : response_(response), name_(name), datatype_(datatype),
+      shape_(shape, shape + dims_count), region_(nullptr),
+      region_base_(nullptr), region_byte_size_(0), buffer_(nullptr),
+      byte_size_(0), memory_type_(TRITONSERVER_MEMORY_CPU),
+      memory_type_id_(0), buffer_userp_(nullptr), allocated_(false),
+      bytes_layout_(TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED)
+{
+  if ((requested != nullptr) && (datatype == TRITONSERVER_TYPE_BYTES)) {
+    bytes_layout_ = requested->bytes_layout_;
+  }
+  if ((requested != nullptr) && (requested->region_ != nullptr)) {
+    region_ = requested->region_;
+    region_->AddRef();
+    region_base_ =
+        reinterpret_cast<const char*>(requested->region_->base_) +
+        requested->offset_;
+    region_byte_size_ = requested->byte_size_;
+  }
+}
+
+InferenceResponse::Output::~Output()
+{
+  if (region_ != nullptr) {
+    region_->Release();
+    return;
+  }
+  if (!allocated_) {
+    return;
+  }
+
+  const ResponseAllocator* allocator = response_->allocator_;
+  TRITONSERVER_Error* err = allocator->release_fn_(
+      reinterpret_cast<TRITONSERVER_ResponseAllocator*>(
+          const_cast<ResponseAllocator*>(allocator)),
+      buffer_, buffer_userp_, byte_size_, memory_type_, memory_type_id_);
+  if (err != nullptr) {
+    const std::string msg =
+        "failed to release buffer for output '" + name_ +
+        "': " + reinterpret_cast<TritonServerError*>(err)->Message();
+    Logger::Log(TRITONSERVER_LOG_ERROR, __FILE__, __LINE__, msg.c_str());
+    TRITONSERVER_ErrorDelete(err);
+  }
+}
+
+TRITONSERVER_Error*
+InferenceResponse::Output::AllocateBuffer(
+    void** buffer, const uint64_t byte_size,
+    TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id)
+{
+  if (allocated_) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_ALREADY_EXISTS,
+        "allocated buffer for output '" + name_ + "' already exists");
+  }
+
+  if (region_base_ != nullptr) {
+    if (byte_size > region_byte_size_) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG,
+          "output '" + name_ + "' requires " + std::to_string(byte_size) +
+              " bytes but its memory region block holds " +
+              std::to_string(region_byte_size_) + " bytes");
+    }
+    buffer_ = const_cast<void*>(region_base_);
+    memory_type_ = TRITONSERVER_MEMORY_CPU;
+    memory_type_id_ = 0;
+  } else {
+    RETURN_IF_ERROR(response_->StartAllocation());
+    const ResponseAllocator* allocator = response_->allocator_;
+    RETURN_IF_ERROR(allocator->alloc_fn_(
+        reinterpret_cast<TRITONSERVER_ResponseAllocator*>(
+            const_cast<ResponseAllocator*>(allocator)),
+        name_.c_str(), byte_size, *memory_type, *memory_type_id,
+        response_->allocator_userp_, &buffer_, &buffer_userp_, &memory_type_,
+        &memory_type_id_));
+  }
+
+  allocated_ = true;
+  byte_size_ = byte_size;
+  *buffer = buffer_;
+  *memory_type = memory_type_;
+  *memory_type_id = memory_type_id_;
+  return nullptr;
+}
+
+//
+// InferenceResponse
+//
+InferenceResponse::InferenceResponse(const InferenceRequest* request)
+    : refcount_(1), model_(request->GetModel()), request_(request),
+      id_(request->id_),
+      allocator_(request->allocator_),
+      allocator_userp_(request->allocator_userp_),
+      response_fn_(request->response_fn_),
+      response_batch_fn_(request->response_batch_fn_),
+      response_userp_(request->response_userp_), allocation_started_(false),
+      error_(nullptr)
+{
+}
+
+InferenceResponse::~InferenceResponse()
+{
+  outputs_.clear();
+  if (error_ != nullptr) {
+    TRITONSERVER_ErrorDelete(error_);
+  }
+}
+
+void
+InferenceResponse::Release()
+{
+  if (refcount_.fetch_sub(1) == 1) {
+    delete this;
+  }
+}
+
+TRITONSERVER_Error*
+InferenceResponse::AddOutput(
+    const char* name, const TRITONSERVER_DataType datatype,
+    const int64_t* shape, const uint32_t dims_count, Output** output)
+{
+  for (const auto& existing : outputs_) {
+    if (existing->Name() == name) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_ALREADY_EXISTS,
+          "output '" + std::string(name) + "' already exists in response");
+    }
+  }
+
+  const InferenceRequest::RequestedOutput* requested = nullptr;
+  for (const auto& routput : request_->RequestedOutputs()) {
+    if (routput.name_ == name) {
+      requested = &routput;
+      break;
+    }
+  }
+
+  outputs_.emplace_back(
+      new Output(this, name, datatype, shape, dims_count, requested));
+  *output = outputs_.back().get();
+  return nullptr;
+}
+
+TRITONSERVER_Error*
+InferenceResponse::AddOutput(
+    const uint32_t slot, const TRITONSERVER_DataType datatype,
+    const int64_t* shape, const uint32_t dims_count, Output** output)
+{
+  const std::vector<std::string>& names = model_->Config()->OutputNames();
+  if (slot >= names.size()) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "output slot " + std::to_string(slot) + " is out of range for model '" +
+            model_->Name() + "'");
+  }
+  for (const auto& existing : outputs_) {
+    if (existing->Name() == names[slot]) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_ALREADY_EXISTS,
+          "output '" + names[slot] + "' already exists in response");
+    }
+  }
+
+  outputs_.emplace_back(new Output(
+      this, names[slot], datatype, shape, dims_count,
+      request_->SlotRequestedOutput(slot)));
+  *output = outputs_.back().get();
+  return nullptr;
+}
+
+void
+InferenceResponse::AddParameter(Parameter&& parameter)
+{
+  parameters_.emplace_back(std::move(parameter));
+}
+
+TRITONSERVER_Error*
+InferenceResponse::StartAllocation()
+{
+  if (!allocation_started_) {
+    allocation_started_ = true;
+    if (allocator_->start_fn_ != nullptr) {
+      RETURN_IF_ERROR(allocator_->start_fn_(
+          reinterpret_cast<TRITONSERVER_ResponseAllocator*>(
+              const_cast<ResponseAllocator*>(allocator_)),
+          allocator_userp_));
+    }
+  }
+
+  return nullptr;
+}
+
+void
+InferenceResponse::PrepareSend(TRITONSERVER_Error* error)
+{
+  if (error != nullptr) {
+    error_ = TRITONSERVER_ErrorNew(
+        TRITONSERVER_ErrorCode(error), TRITONSERVER_ErrorMessage(error));
+  }
+
+  // The request may be released before the response is deleted.
+  request_ = nullptr;
+}
+
+void
+InferenceResponse::Send(const uint32_t send_flags, TRITONSERVER_Error* error)
+{
+  InferenceResponse* response = this;
+  SendBatch(&response, 1, &send_flags, &error);
+}
+
+void
+InferenceResponse::SendBatch(
+    InferenceResponse** responses, const uint32_t response_count,
+    const uint32_t* send_flags, TRITONSERVER_Error** errors)
+{
+  // The responses for a batch callback, in the order they were sent.
+  struct Batch {
+    TRITONSERVER_InferenceResponseBatchCompleteFn_t fn_;
+    std::vector<TRITONSERVER_InferenceResponse*> responses_;
+    std::vector<uint32_t> flags_;
+    std::vector<void*> userps_;
+  };
+  std::vector<Batch> batches;
+
+  // Every response of a request has the same callback, so delivering
+  // the individual responses first and then each batch preserves the
+  // order of the responses of each request.
+  for (uint32_t r = 0; r < response_count; ++r) {
+    InferenceResponse* response = responses[r];
+    response->PrepareSend((errors == nullptr) ? nullptr : errors[r]);
+    TRITONSERVER_InferenceResponse* tresponse =
+        reinterpret_cast<TRITONSERVER_InferenceResponse*>(response);
+    if (response->response_fn_ != nullptr) {
+      response->response_fn_(
+          tresponse, send_flags[r], response->response_userp_);
+      continue;
+    }
+
+    Batch* batch = nullptr;
+    for (auto& existing : batches) {
+      if (existing.fn_ == response->response_batch_fn_) {
+        batch = &existing;
+        break;
+      }
+    }
+    if (batch == nullptr) {
+      batches.emplace_back();
+      batch = &batches.back();
+      batch->fn_ = response->response_batch_fn_;
+    }
+    batch->responses_.push_back(tresponse);
+    batch->flags_.push_back(send_flags[r]);
+    batch->userps_.push_back(response->response_userp_);
+  }
+
+  for (auto& batch : batches) {
+    batch.fn_(
+        batch.responses_.data(), batch.flags_.data(), batch.userps_.data(),
+        batch.responses_.size());
+  }
+}
+
+//
+// ModelInstance
+//
+namespace {
+
+// The instance whose thread is the calling thread, if any.
+thread_local const ModelInstance* current_instance = nullptr;
+
+}  // namespace
+
+ModelInstance::ModelInstance(Model* model, const uint32_t index)
+    : model_(model), name_(model->Name() + "_" + std::to_string(index)),
+      state_(nullptr)
+{
+}
+
+void
+ModelInstance::Start()
+{
+  // Assigning to a joinable thread terminates the process, so join a
+  // thread left by an earlier start first.
+  Join();
+  thread_ = std::thread(&ModelInstance::Run, this);
+}
+
+void
+ModelInstance::Join()
+{
+  // Joining the calling thread throws, Model::Stop refuses to run on
+  // an instance thread so this only guards against misuse.
+  if (thread_.joinable() && (thread_.get_id() != std::this_thread::get_id())) {
+    thread_.join();
+  }
+}
+
+void
+ModelInstance::Run()
+{
+  current_instance = this;
+  while (true) {
+    InferenceRequest* request = model_->Dequeue();
+    if (request == nullptr) {
+      break;
+    }
+
+    if ((request->timeout_us_ != 0) &&
+        (Elapsed(request->QueueStartNs(), NowNs()) >
+         (request->timeout_us_ * 1000))) {
+      model_->FailRequest(
+          request, TritonServerError::Create(
+                       TRITONSERVER_ERROR_UNAVAILABLE,
+                       "Request timeout expired"));
+      continue;
+    }
+
+    model_->Execute(this, &request, 1);
+  }
+}
+
+//
+// Model
+//
+Model::Model(Server* server, ModelConfig* config)
+    : server_(server), config_(config), state_(config), ready_(false),
+      exiting_(false), stats_change_token_(0)
+{
+  for (uint32_t i = 0; i < config_->InstanceCount(); ++i) {
+    instances_.emplace_back(new ModelInstance(this, i));
+  }
+}
+
+Model::~Model()
+{
+  TRITONSERVER_Error* err = Stop();
+  if (err != nullptr) {
+    Logger::Log(
+        TRITONSERVER_LOG_ERROR, __FILE__, __LINE__,
+        reinterpret_cast<TritonServerError*>(err)->Message().c_str());
+    TRITONSERVER_ErrorDelete(err);
+  }
+  config_->Release();
+}
+
+bool
+Model::OnInstanceThread() const
+{
+  return (current_instance != nullptr) &&
+         (current_instance->GetModel() == this);
+}
+
+TRITONSERVER_Error*
+Model::Start()
+{
+  // A stop in progress holds the lifecycle mutex while it joins the
+  // calling thread, so do not wait for it.
+  if (OnInstanceThread()) {
+    if (IsReady()) {
+      return nullptr;
+    }
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_UNAVAILABLE,
+        "model '" + Name() + "' cannot be loaded from one of its instance "
+                             "threads while it is unloading");
+  }
+
+  std::lock_guard<std::mutex> lifecycle_lock(lifecycle_mu_);
+  if (IsReady()) {
+    return nullptr;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(queue_mu_);
+    exiting_ = false;
+  }
+
+  for (auto& instance : instances_) {
+    instance->Start();
+  }
+
+  SetReady(true);
+  return nullptr;
+}
+
+TRITONSERVER_Error*
+Model::Stop()
+{
+  if (OnInstanceThread()) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_UNAVAILABLE,
+        "model '" + Name() +
+            "' cannot be unloaded from one of its instance threads");
+  }
+
+  std::lock_guard<std::mutex> lifecycle_lock(lifecycle_mu_);
+  SetReady(false);
+
+  {
+    std::lock_guard<std::mutex> lock(queue_mu_);
+    exiting_ = true;
+  }
+  queue_cv_.notify_all();
+
+  // The instances finish the requests already queued before exiting.
+  for (auto& instance : instances_) {
+    instance->Join();
+  }
+
+  return nullptr;
+}
+
+TRITONSERVER_Error*
+Model::Enqueue(InferenceRequest** requests, const uint32_t count)
+{
+  {
+    std::lock_guard<std::mutex> lock(queue_mu_);
+    if (exiting_) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_UNAVAILABLE,
+          "Request for unknown model: '" + Name() +
+              "' has no available versions");
+    }
+
+    const uint64_t now_ns = NowNs();
+    for (uint32_t i = 0; i < count; ++i) {
+      requests[i]->SetQueueStartNs(now_ns);
+      queue_.push_back(requests[i]);
+    }
+  }
+
+  if (count == 1) {
+    queue_cv_.notify_one();
+  } else {
+    queue_cv_.notify_all();
+  }
+
+  return nullptr;
+}
+
+InferenceRequest*
+Model::Dequeue()
+{
+  std::unique_lock<std::mutex> lock(queue_mu_);
+  queue_cv_.wait(lock, [this] { return exiting_ || !queue_.empty(); });
+  if (queue_.empty()) {
+    return nullptr;
+  }
+
+  InferenceRequest* request = queue_.front();
+  queue_.pop_front();
+  return request;
+}
+
+void
+Model::Execute(
+    ModelInstance* instance, InferenceRequest** requests, const uint32_t count)
+{
+  // As for a backend, if execution fails as a whole then none of the
+  // requests have been released and Triton completes them with the
+  // error.
+  TRITONSERVER_Error* err = IdentityModelExecute(
+      reinterpret_cast<TRITONBACKEND_ModelInstance*>(instance),
+      reinterpret_cast<TRITONBACKEND_Request**>(requests), count);
+  if (err != nullptr) {
+    for (uint32_t i = 0; i < count; ++i) {
+      FailRequest(
+          requests[i],
+          TRITONSERVER_ErrorNew(
+              TRITONSERVER_ErrorCode(err), TRITONSERVER_ErrorMessage(err)));
+    }
+    TRITONSERVER_ErrorDelete(err);
+  }
+}
+
+void
+Model::FailRequest(InferenceRequest* request, TRITONSERVER_Error* error)
+{
+  const uint64_t now_ns = NowNs();
+  InferenceResponse* response = new InferenceResponse(request);
+  response->Send(TRITONSERVER_RESPONSE_COMPLETE_FINAL, error);
+  TRITONSERVER_ErrorDelete(error);
+  ReportStatistics(request, false, now_ns, now_ns, now_ns, now_ns);
+  request->Release(TRITONSERVER_REQUEST_RELEASE_ALL);
+}
+
+void
+Model::ReportStatistics(
+    InferenceRequest* request, const bool success,
+    const uint64_t exec_start_ns, const uint64_t compute_start_ns,
+    const uint64_t compute_end_ns, const uint64_t exec_end_ns)
+{
+  const uint64_t queue_start_ns = request->QueueStartNs();
+  const uint64_t now_ms =
+      std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::system_clock::now().time_since_epoch())
+          .count();
+
+  std::lock_guard<std::mutex> lock(stats_mu_);
+  stats_.last_inference_ms_ = now_ms;
+  if (success) {
+    stats_.success_.Add(Elapsed(queue_start_ns, exec_end_ns));
+    stats_.queue_.Add(Elapsed(queue_start_ns, exec_start_ns));
+    stats_.compute_input_.Add(Elapsed(exec_start_ns, compute_start_ns));
+    stats_.compute_infer_.Add(Elapsed(compute_start_ns, compute_end_ns));
+    stats_.compute_output_.Add(Elapsed(compute_end_ns, exec_end_ns));
+  } else {
+    stats_.fail_.Add(Elapsed(queue_start_ns, exec_end_ns));
+  }
+  stats_change_token_ = server_->NextStatisticsToken();
+}
+
+void
+Model::ReportBatchStatistics(
+    const uint64_t batch_size, const uint64_t exec_start_ns,
+    const uint64_t compute_start_ns, const uint64_t compute_end_ns,
+    const uint64_t exec_end_ns)
+{
+  std::lock_guard<std::mutex> lock(stats_mu_);
+  stats_.inference_count_ += batch_size;
+  stats_.execution_count_++;
+  BatchStats& batch_stats = stats_.batch_stats_[batch_size];
+  batch_stats.compute_input_.Add(Elapsed(exec_start_ns, compute_start_ns));
+  batch_stats.compute_infer_.Add(Elapsed(compute_start_ns, compute_end_ns));
+  batch_stats.compute_output_.Add(Elapsed(compute_end_ns, exec_end_ns));
+  stats_change_token_ = server_->NextStatisticsToken();
+}
+
+void
+Model::Statistics(ModelStats* stats, uint64_t* change_token) const
+{
+  std::lock_guard<std::mutex> lock(stats_mu_);
+  *stats = stats_;
+  *change_token = stats_change_token_;
+}
+
+void
+Model::CounterStatistics(ModelStats* stats, uint64_t* change_token) const
+{
+  std::lock_guard<std::mutex> lock(stats_mu_);
+  stats->last_inference_ms_ = stats_.last_inference_ms_;
+  stats->inference_count_ = stats_.inference_count_;
+  stats->execution_count_ = stats_.execution_count_;
+  stats->success_ = stats_.success_;
+  stats->fail_ = stats_.fail_;
+  stats->queue_ = stats_.queue_;
+  stats->compute_input_ = stats_.compute_input_;
+  stats->compute_infer_ = stats_.compute_infer_;
+  stats->compute_output_ = stats_.compute_output_;
+  *change_token = stats_change_token_;
+}
+
+//
+// Server
+//
+Server::Server(const ServerOptions& options)
+    : id_(options.server_id_), metrics_(options.metrics_),
+      strict_readiness_(options.strict_readiness_), live_(true),
+      stats_token_(0)
+{
+}
+
+TRITONSERVER_Error*
+Server::Create(const ServerOptions& options, std::unique_ptr<Server>* server)
+{
+  Logger::SetEnabled(TRITONSERVER_LOG_INFO, options.log_info_);
+  Logger::SetEnabled(TRITONSERVER_LOG_WARN, options.log_warn_);
+  Logger::SetEnabled(TRITONSERVER_LOG_ERROR, options.log_error_);
+  Logger::SetVerboseLevel(options.log_verbose_);
+
+  ModelConfig* config;
+  RETURN_IF_ERROR(ModelConfig::Create(options.loopback_config_, &config));
+
+  std::unique_ptr<Server> lserver(new Server(options));
+  lserver->model_.reset(new Model(lserver.get(), config));
+
+  bool load = true;
+  if (options.model_control_mode_ == TRITONSERVER_MODEL_CONTROL_EXPLICIT) {
+    load = false;
+    for (const auto& name : options.startup_models_) {
+      if (name != config->Name()) {
+        return TritonServerError::Create(
+            TRITONSERVER_ERROR_NOT_FOUND,
+            "failed to load startup model '" + name + "': model not found");
+      }
+      load = true;
+    }
+  }
+
+  if (load) {
+    RETURN_IF_ERROR(lserver->model_->Start());
+  }
+
+  if (Logger::IsEnabled(TRITONSERVER_LOG_INFO)) {
+    const std::string msg = "loopback server '" + lserver->id_ +
+                            "' started with model '" + config->Name() + "'";
+    Logger::Log(TRITONSERVER_LOG_INFO, __FILE__, __LINE__, msg.c_str());
+  }
+
+  *server = std::move(lserver);
+  return nullptr;
+}
+
+Server::~Server()
+{
+  TRITONSERVER_Error* err = Stop();
+  if (err != nullptr) {
+    Logger::Log(
+        TRITONSERVER_LOG_ERROR, __FILE__, __LINE__,
+        reinterpret_cast<TritonServerError*>(err)->Message().c_str());
+    TRITONSERVER_ErrorDelete(err);
+  }
+
+  // A region still in use is deleted when its last user releases it.
+  for (MemoryRegion* region : regions_) {
+    region->Release();
+  }
+}
+
+bool
+Server::IsReady() const
+{
+  return IsLive() && (!strict_readiness_ || model_->IsReady());
+}
+
+TRITONSERVER_Error*
+Server::FindModel(
+    const char* model_name, const int64_t model_version, Model** model)
+{
+  if (model_->Name() != model_name) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_NOT_FOUND, "Request for unknown model: '" +
+                                          std::string(model_name) +
+                                          "' is not found");
+  }
+  if ((model_version != -1) && (model_version != model_->Version())) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_NOT_FOUND,
+        "Request for unknown model: '" + std::string(model_name) +
+            "' version " + std::to_string(model_version) + " is not found");
+  }
+
+  *model = model_.get();
+  return nullptr;
+}
+
+TRITONSERVER_Error*
+Server::LoadModel(const char* model_name)
+{
+  Model* model;
+  RETURN_IF_ERROR(FindModel(model_name, -1, &model));
+  return model->Start();
+}
+
+TRITONSERVER_Error*
+Server::UnloadModel(const char* model_name)
+{
+  Model* model;
+  RETURN_IF_ERROR(FindModel(model_name, -1, &model));
+  return model->Stop();
+}
+
+TRITONSERVER_Error*
+Server::Stop()
+{
+  if (model_->OnInstanceThread()) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_UNAVAILABLE,
+        "server '" + id_ +
+            "' cannot be stopped from one of its model instance threads");
+  }
+
+  live_.store(false);
+  return model_->Stop();
+}
+
+TRITONSERVER_Error*
+Server::InferAsync(InferenceRequest** requests, const uint32_t request_count)
+{
+  if (!IsLive()) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_UNAVAILABLE, "Server is not live");
+  }
+  if (request_count == 0) {
+    return nullptr;
+  }
+
+  Model* model = requests[0]->GetModel();
+  for (uint32_t i = 0; i < request_count; ++i) {
+    if (requests[i]->GetModel() != model) {
+      return TritonServerError::Create(
+          TRITONSERVER_ERROR_INVALID_ARG,
+          "all requests of a batch must be for the same model and version");
+    }
+  }
+  if (!model->IsReady()) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_UNAVAILABLE, "Request for unknown model: '" +
+                                            model->Name() +
+                                            "' has no available versions");
+  }
+
+  for (uint32_t i = 0; i < request_count; ++i) {
+    RETURN_IF_ERROR(requests[i]->PrepareForInference());
+  }
+
+  return model->Enqueue(requests, request_count);
+}
+
+TRITONSERVER_Error*
+Server::RegisterMemoryRegion(
+    const void* base, const size_t byte_size, MemoryRegion** region)
+{
+  *region = new MemoryRegion(base, byte_size);
+
+  std::lock_guard<std::mutex> lock(regions_mu_);
+  regions_.insert(*region);
+  return nullptr;
+}
+
+TRITONSERVER_Error*
+Server::UnregisterMemoryRegion(MemoryRegion* region)
+{
+  std::lock_guard<std::mutex> lock(regions_mu_);
+  auto itr = regions_.find(region);
+  if (itr == regions_.end()) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_NOT_FOUND,
+        "memory region is not registered with the server");
+  }
+  if (!region->ReleaseIfUnused()) {
+    return TritonServerError::Create(
+        TRITONSERVER_ERROR_UNAVAILABLE,
+        "memory region is still referenced by an inference request or "
+        "response");
+  }
+
+  regions_.erase(itr);
+  return nullptr;
+}
+
+std::string
+Server::MetadataJson() const
+{
+  std::string json("{\"name\":");
+  AppendJsonString(&json, id_);
+  json.append(
+      ",\"version\":\"loopback\",\"extensions\":[\"model_configuration\","
+      "\"model_repository\",\"statistics\"]}");
+  return json;
+}
+
+std::string
+Server::ModelIndexJson(const uint32_t flags) const
+{
+  const bool ready = model_->IsReady();
+  if (((flags & TRITONSERVER_INDEX_FLAG_READY) != 0) && !ready) {
+    return "[]";
+  }
+
+  std::string json("[{\"name\":");
+  AppendJsonString(&json, model_->Name());
+  json.append(",\"version\":\"1\",\"state\":");
+  json.append(
+      ready ? "\"READY\"}]" : "\"UNAVAILABLE\",\"reason\":\"unloaded\"}]");
+  return json;
+}
+
+std::string
+Server::ModelStatisticsJson() const
+{
+  ModelStats stats;
+  uint64_t change_token;
+  model_->Statistics(&stats, &change_token);
+
+  const StatDuration no_cache;
+  std::string json("{\"model_stats\":[{\"name\":");
+  AppendJsonString(&json, model_->Name());
+  json.append(",\"version\":\"1\",\"last_inference\":");
+  json.append(std::to_string(stats.last_inference_ms_));
+  json.append(",\"inference_count\":");
+  json.append(std::to_string(stats.inference_count_));
+  json.append(",\"execution_count\":");
+  json.append(std::to_string(stats.execution_count_));
+  json.append(",\"instance_activation_count\":0");
+  json.append(",\"instance_deactivation_count\":0");
+  json.append(",\"active_instance_count\":");
+  json.append(std::to_string(ActiveInstanceCount()));
+  json.append(",\"inference_stats\":{");
+  AppendJsonDuration(&json, "success", stats.success_);
+  json.append(",");
+  AppendJsonDuration(&json, "fail", stats.fail_);
+  json.append(",");
+  AppendJsonDuration(&json, "queue", stats.queue_);
+  json.append(",");
+  AppendJsonDuration(&json, "compute_input", stats.compute_input_);
+  json.append(",");
+  AppendJsonDuration(&json, "compute_infer", stats.compute_infer_);
+  json.append(",");
+  AppendJsonDuration(&json, "compute_output", stats.compute_output_);
+  json.append(",");
+  AppendJsonDuration(&json, "cache_hit", no_cache);
+  json.append(",");
+  AppendJsonDuration(&json, "cache_miss", no_cache);
+  json.append(",\"cache_eviction_count\":0},\"batch_stats\":[");
+  bool first = true;
+  for (const auto& batch : stats.batch_stats_) {
+    if (!first) {
+      json.append(",");
+    }
+    first = false;
+    json.append("{\"batch_size\":");
+    json.append(std::to_string(batch.first));
+    json.append(",");
+    AppendJsonDuration(&json, "compute_input", batch.second.compute_input_);
+    json.append(",");
+    AppendJsonDuration(&json, "compute_infer", batch.second.compute_infer_);
+    json.append(",");
+    AppendJsonDuration(&json, "compute_output", batch.second.compute_output_);
+    json.append("}");
+  }
+  json.append("]}]}");
+  return json;
+}
+
+std::string
+Server::MetricsText() const
+{
+  ModelStats stats;
+  uint64_t change_token;
+  model_->CounterStatistics(&stats, &change_token);
+
+  const std::string labels = "{model=\"" + model_->Name() + "\",version=\"1\"}";
+  std::string text;
+  AppendPrometheusMetric(
+      &text, "nv_inference_request_success",
+      "Number of successful inference requests, all batch sizes", "counter",
+      labels, stats.success_.count_);
+  AppendPrometheusMetric(
+      &text, "nv_inference_request_failure",
+      "Number of failed inference requests, all batch sizes", "counter",
+      labels, stats.fail_.count_);
+  AppendPrometheusMetric(
+      &text, "nv_inference_count",
+      "Number of inferences performed (does not include cached requests)",
+      "counter", labels, stats.inference_count_);
+  AppendPrometheusMetric(
+      &text, "nv_inference_exec_count",
+      "Number of model executions performed (does not include cached "
+      "requests)",
+      "counter", labels, stats.execution_count_);
+  AppendPrometheusMetric(
+      &text, "nv_inference_request_duration_us",
+      "Cumulative inference request duration in microseconds (includes "
+      "cached requests)",
+      "counter", labels, stats.success_.ns_ / 1000);
+  AppendPrometheusMetric(
+      &text, "nv_inference_queue_duration_us",
+      "Cumulative inference queuing duration in microseconds (includes "
+      "cached requests)",
+      "counter", labels, stats.queue_.ns_ / 1000);
+  AppendPrometheusMetric(
+      &text, "nv_inference_compute_input_duration_us",
+      "Cumulative compute input duration in microseconds (does not include "
+      "cached requests)",
+      "counter", labels, stats.compute_input_.ns_ / 1000);
+  AppendPrometheusMetric(
+      &text, "nv_inference_compute_infer_duration_us",
+      "Cumulative compute inference duration in microseconds (does not "
+      "include cached requests)",
+      "counter", labels, stats.compute_infer_.ns_ / 1000);
+  AppendPrometheusMetric(
+      &text, "nv_inference_compute_output_duration_us",
+      "Cumulative inference compute output duration in microseconds (does "
+      "not include cached requests)",
+      "counter", labels, stats.compute_output_.ns_ / 1000);
+  return text;
+}
+
+void
+Server::StatisticsRecord(
+    TRITONSERVER_ModelStatisticsRecord* record, uint64_t* change_token) const
+{
+  ModelStats stats;
+  model_->CounterStatistics(&stats, change_token);
+
+  memset(record, 0, sizeof(TRITONSERVER_ModelStatisticsRecord));
+  record->model_name = model_->Name().c_str();
+  record->model_version = model_->Version();
+  record->last_inference_ms = stats.last_inference_ms_;
+  record->inference_count = stats.inference_count_;
+  record->execution_count = stats.execution_count_;
+  record->success_count = stats.success_.count_;
+  record->success_ns = stats.success_.ns_;
+  record->fail_count = stats.fail_.count_;
+  record->fail_ns = stats.fail_.ns_;
+  record->queue_count = stats.queue_.count_;
+  record->queue_ns = stats.queue_.ns_;
+  record->compute_input_count = stats.compute_input_.count_;
+  record->compute_input_ns = stats.compute_input_.ns_;
+  record->compute_infer_count = stats.compute_infer_.count_;
+  record->compute_infer_ns = stats.compute_infer_.ns_;
+  record->compute_output_count = stats.compute_output_.count_;
+  record->compute_output_ns = stats.compute_output_.ns_;
+  record->active_instance_count = ActiveInstanceCount();
+}
+
+uint64_t
+Server::ActiveInstanceCount() const
+{
+  // All instances of the identity model are non-passive and so are
+  // active while the model is ready.
+  return model_->IsReady() ? model_->Config()->InstanceCount() : 0;
+}
+
+}}}  // namespace triton::core::loopback
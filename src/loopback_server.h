@@ -0,0 +1,735 @@
+// Copyright 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "triton/core/tritonbackend.h"
+#include "triton/core/tritonserver.h"
+
+//
+// Internal implementation of the loopback server. The loopback server
+// implements the TRITONSERVER API in-process against a single
+// "identity" model that copies each input tensor INPUTn to the output
+// tensor OUTPUTn. The opaque API objects are the classes below, for
+// example a TRITONSERVER_InferenceRequest and a TRITONBACKEND_Request
+// are both an InferenceRequest.
+//
+namespace triton { namespace core { namespace loopback {
+
+#define RETURN_IF_ERROR(X)             \
+  do {                                 \
+    TRITONSERVER_Error* err__ = (X);   \
+    if (err__ != nullptr) {            \
+      return err__;                    \
+    }                                  \
+  } while (false)
+
+class InferenceResponse;
+class Model;
+class Server;
+
+// Steady-clock timestamp in nanoseconds, as used for the statistics.
+uint64_t NowNs();
+
+// Implementation of TRITONSERVER_BytesLayoutConvert.
+TRITONSERVER_Error* ConvertBytesLayout(
+    const TRITONSERVER_BytesLayout src_layout, const char* src,
+    const size_t src_byte_size, const uint64_t element_count,
+    const TRITONSERVER_BytesLayout dst_layout, char* dst,
+    const size_t dst_byte_size, size_t* converted_byte_size);
+
+//
+// Implementation of TRITONSERVER_Error.
+//
+class TritonServerError {
+ public:
+  static TRITONSERVER_Error* Create(
+      TRITONSERVER_Error_Code code, const std::string& msg);
+
+  TRITONSERVER_Error_Code Code() const { return code_; }
+  const std::string& Message() const { return msg_; }
+
+ private:
+  TritonServerError(TRITONSERVER_Error_Code code, const std::string& msg)
+      : code_(code), msg_(msg)
+  {
+  }
+
+  TRITONSERVER_Error_Code code_;
+  const std::string msg_;
+};
+
+//
+// Process-wide log settings. The levels are read with a single relaxed
+// load so that checking a disabled level is cheap.
+//
+class Logger {
+ public:
+  static bool IsEnabled(TRITONSERVER_LogLevel level);
+  static void SetEnabled(TRITONSERVER_LogLevel level, bool enable);
+  static void SetVerboseLevel(int level);
+  static void Log(
+      TRITONSERVER_LogLevel level, const char* filename, const int line,
+      const char* msg);
+
+ private:
+  static std::atomic<bool> info_;
+  static std::atomic<bool> warn_;
+  static std::atomic<bool> error_;
+  static std::atomic<int> verbose_;
+  static std::mutex mu_;
+};
+
+//
+// Implementation of TRITONSERVER_Message and TRITONSERVER_Metrics,
+// both of which are serialized text.
+//
+class Message {
+ public:
+  explicit Message(std::string&& serialized)
+      : serialized_(std::move(serialized))
+  {
+  }
+  const std::string& Serialized() const { return serialized_; }
+
+ private:
+  const std::string serialized_;
+};
+
+//
+// Implementation of TRITONSERVER_ResponseAllocator.
+//
+struct ResponseAllocator {
+  TRITONSERVER_ResponseAllocatorAllocFn_t alloc_fn_;
+  TRITONSERVER_ResponseAllocatorReleaseFn_t release_fn_;
+  TRITONSERVER_ResponseAllocatorStartFn_t start_fn_;
+};
+
+//
+// Implementation of TRITONSERVER_MemoryRegion. Only regions of
+// TRITONSERVER_MEMORY_REGION_SYSTEM kind can be registered. The
+// region is reference counted, the registration holding one reference
+// and each request input, requested output and response output whose
+// data is in the region holding another, so that the region cannot be
+// unregistered while it is in use.
+//
+class MemoryRegion {
+ public:
+  MemoryRegion(const void* base, const size_t byte_size)
+      : base_(base), byte_size_(byte_size), refcount_(1)
+  {
+  }
+
+  void AddRef() { refcount_.fetch_add(1); }
+  void Release();
+
+  // Release the reference held by the registration if it is the only
+  // reference, returning false if the region is still in use.
+  bool ReleaseIfUnused();
+
+  const void* const base_;
+  const size_t byte_size_;
+
+ private:
+  std::atomic<uint32_t> refcount_;
+};
+
+//
+// Implementation of TRITONSERVER_ServerOptions. Only the options that
+// are meaningful for the loopback server are recorded, all others are
+// accepted and ignored.
+//
+struct ServerOptions {
+  ServerOptions();
+
+  std::string server_id_;
+  bool log_info_;
+  bool log_warn_;
+  bool log_error_;
+  int log_verbose_;
+  bool metrics_;
+  bool strict_readiness_;
+  std::vector<std::string> startup_models_;
+  TRITONSERVER_ModelControlMode model_control_mode_;
+  std::map<std::string, std::string> loopback_config_;
+};
+
+//
+// Configuration of the identity model, parsed from the "loopback"
+// backend configuration. Also the implementation of
+// TRITONSERVER_ModelConfigView. The configuration is immutable and
+// reference counted so that a view acquired by
+// TRITONSERVER_ServerModelConfigView stays valid after the server is
+// deleted.
+//
+class ModelConfig {
+ public:
+  static TRITONSERVER_Error* Create(
+      const std::map<std::string, std::string>& settings,
+      ModelConfig** config);
+
+  void AddRef() { refcount_.fetch_add(1); }
+  void Release();
+
+  const std::string& Name() const { return name_; }
+  TRITONSERVER_DataType DataType() const { return datatype_; }
+  uint64_t ComputeDelayUs() const { return compute_delay_us_; }
+  uint64_t OutputByteSize() const { return output_byte_size_; }
+  uint32_t InstanceCount() const { return instance_count_; }
+  const std::vector<std::string>& InputNames() const { return input_names_; }
+  const std::vector<std::string>& OutputNames() const
+  {
+    return output_names_;
+  }
+  const int64_t* InputShape() const { return &input_shape_; }
+  TRITONSERVER_DataType OutputDataType() const { return output_datatype_; }
+  const int64_t* OutputShape() const { return &output_shape_; }
+
+  // Return the slot of the input or output with the given name, or
+  // false if there is no such input or output.
+  bool InputSlot(const char* name, uint32_t* slot) const;
+  bool OutputSlot(const char* name, uint32_t* slot) const;
+
+  // The configuration as model configuration and model metadata JSON.
+  std::string ConfigJson() const;
+  std::string MetadataJson() const;
+
+ private:
+  ModelConfig() : refcount_(1) {}
+
+  std::atomic<uint32_t> refcount_;
+  std::string name_;
+  TRITONSERVER_DataType datatype_;
+  uint64_t compute_delay_us_;
+  uint64_t output_byte_size_;
+  uint32_t instance_count_;
+  std::vector<std::string> input_names_;
+  std::vector<std::string> output_names_;
+  const int64_t input_shape_ = -1;
+  TRITONSERVER_DataType output_datatype_;
+  int64_t output_shape_;
+};
+
+//
+// Implementation of TRITONSERVER_InferenceRequest and
+// TRITONBACKEND_Request.
+//
+class InferenceRequest {
+ public:
+  struct Buffer {
+    const void* base_;
+    size_t byte_size_;
+    TRITONSERVER_MemoryType memory_type_;
+    int64_t memory_type_id_;
+  };
+
+  // Implementation of TRITONBACKEND_Input.
+  class Input {
+   public:
+    Input(
+        const std::string& name, const TRITONSERVER_DataType datatype,
+        const int64_t* shape, const uint64_t dim_count);
+    ~Input();
+
+    const std::string& Name() const { return name_; }
+    TRITONSERVER_DataType DataType() const { return datatype_; }
+    const std::vector<int64_t>& Shape() const { return shape_; }
+
+    // The data as read by the backend, converted to the BYTES layout
+    // selected by the backend if it differs from the layout of the
+    // appended data.
+    uint64_t ByteSize() const
+    {
+      return converted_ ? converted_data_.size() : byte_size_;
+    }
+    const std::vector<Buffer>& Buffers() const
+    {
+      return converted_ ? converted_buffers_ : buffers_;
+    }
+
+    TRITONSERVER_Error* AppendData(
+        const void* base, size_t byte_size,
+        TRITONSERVER_MemoryType memory_type, int64_t memory_type_id);
+    void RemoveAllData();
+
+    // The BYTES layout of the appended data, and the layout in which
+    // the backend reads it.
+    TRITONSERVER_BytesLayout BytesLayout() const { return bytes_layout_; }
+    void SetBytesLayout(const TRITONSERVER_BytesLayout layout);
+    TRITONSERVER_Error* SetBackendBytesLayout(
+        const TRITONSERVER_BytesLayout layout);
+
+    // Hold a reference to the response or memory region that owns
+    // data appended to the input, released when the data is removed.
+    void HoldResponse(InferenceResponse* response);
+    void HoldRegion(MemoryRegion* region);
+
+   private:
+    const std::string name_;
+    const TRITONSERVER_DataType datatype_;
+    const std::vector<int64_t> shape_;
+    uint64_t byte_size_;
+    std::vector<Buffer> buffers_;
+    std::vector<InferenceResponse*> held_responses_;
+    std::vector<MemoryRegion*> held_regions_;
+    TRITONSERVER_BytesLayout bytes_layout_;
+    bool converted_;
+    std::vector<char> converted_data_;
+    std::vector<Buffer> converted_buffers_;
+  };
+
+  // The request holds a reference to 'region_', if any.
+  struct RequestedOutput {
+    std::string name_;
+    MemoryRegion* region_;
+    size_t offset_;
+    size_t byte_size_;
+    TRITONSERVER_BytesLayout bytes_layout_;
+  };
+
+  InferenceRequest(Server* server, Model* model);
+  ~InferenceRequest();
+
+  Server* GetServer() const { return server_; }
+  Model* GetModel() const { return model_; }
+
+  std::string id_;
+  uint32_t flags_;
+  uint64_t correlation_id_;
+  std::string correlation_id_string_;
+  bool correlation_id_is_string_;
+  uint32_t priority_;
+  uint64_t timeout_us_;
+
+  TRITONSERVER_InferenceRequestReleaseFn_t release_fn_;
+  void* release_userp_;
+  const ResponseAllocator* allocator_;
+  void* allocator_userp_;
+  TRITONSERVER_InferenceResponseCompleteFn_t response_fn_;
+  TRITONSERVER_InferenceResponseBatchCompleteFn_t response_batch_fn_;
+  void* response_userp_;
+
+  const std::vector<std::unique_ptr<Input>>& Inputs() const
+  {
+    return inputs_;
+  }
+  Input* FindInput(const char* name) const;
+  TRITONSERVER_Error* AddInput(
+      const char* name, const TRITONSERVER_DataType datatype,
+      const int64_t* shape, const uint64_t dim_count);
+  TRITONSERVER_Error* RemoveInput(const char* name);
+  void RemoveAllInputs();
+  void RemoveAllInputData();
+
+  const std::vector<RequestedOutput>& RequestedOutputs() const
+  {
+    return requested_outputs_;
+  }
+  TRITONSERVER_Error* AddRequestedOutput(const char* name);
+  TRITONSERVER_Error* SetRequestedOutputRegion(
+      const char* name, MemoryRegion* region, size_t offset,
+      size_t byte_size);
+  TRITONSERVER_Error* SetRequestedOutputBytesLayout(
+      const char* name, const TRITONSERVER_BytesLayout layout);
+  TRITONSERVER_Error* RemoveRequestedOutput(const char* name);
+  void RemoveAllRequestedOutputs();
+
+  // Validate the request against the model and prepare it for
+  // execution, ordering the inputs and requested outputs by slot.
+  TRITONSERVER_Error* PrepareForInference();
+
+  // The input or requested output in a slot, or nullptr / false if
+  // the request does not have it. Valid only after
+  // PrepareForInference.
+  Input* SlotInput(const uint32_t slot) const;
+  bool SlotOutputRequested(const uint32_t slot) const;
+  const RequestedOutput* SlotRequestedOutput(const uint32_t slot) const;
+
+  uint64_t QueueStartNs() const { return queue_start_ns_; }
+  void SetQueueStartNs(uint64_t ns) { queue_start_ns_ = ns; }
+
+  // Release the request to its owner through the release callback.
+  void Release(const uint32_t release_flags);
+
+ private:
+  Server* server_;
+  Model* model_;
+  std::vector<std::unique_ptr<Input>> inputs_;
+  std::vector<RequestedOutput> requested_outputs_;
+  std::vector<Input*> slot_inputs_;
+  std::vector<const RequestedOutput*> slot_outputs_;
+  uint64_t queue_start_ns_;
+};
+
+//
+// Implementation of TRITONSERVER_InferenceResponse and
+// TRITONBACKEND_Response.
+//
+class InferenceResponse {
+ public:
+  // Implementation of TRITONBACKEND_Output.
+  class Output {
+   public:
+    Output(
+        InferenceResponse* response, const std::string& name,
+        const TRITONSERVER_DataType datatype, const int64_t* shape,
+        const uint32_t dims_count,
+        const InferenceRequest::RequestedOutput* requested);
+    ~Output();
+
+    const std::string& Name() const { return name_; }
+    TRITONSERVER_DataType DataType() const { return datatype_; }
+    const std::vector<int64_t>& Shape() const { return shape_; }
+    const void* Base() const { return buffer_; }
+    size_t ByteSize() const { return byte_size_; }
+    TRITONSERVER_MemoryType MemoryType() const { return memory_type_; }
+    int64_t MemoryTypeId() const { return memory_type_id_; }
+    void* BufferUserp() const { return buffer_userp_; }
+    TRITONSERVER_BytesLayout BytesLayout() const { return bytes_layout_; }
+
+    TRITONSERVER_Error* AllocateBuffer(
+        void** buffer, const uint64_t byte_size,
+        TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id);
+
+   private:
+    InferenceResponse* response_;
+    const std::string name_;
+    const TRITONSERVER_DataType datatype_;
+    const std::vector<int64_t> shape_;
+    MemoryRegion* region_;
+    const void* region_base_;
+    size_t region_byte_size_;
+    void* buffer_;
+    size_t byte_size_;
+    TRITONSERVER_MemoryType memory_type_;
+    int64_t memory_type_id_;
+    void* buffer_userp_;
+    bool allocated_;
+    TRITONSERVER_BytesLayout bytes_layout_;
+  };
+
+  struct Parameter {
+    std::string name_;
+    TRITONSERVER_ParameterType type_;
+    std::string string_value_;
+    int64_t int_value_;
+    bool bool_value_;
+  };
+
+  explicit InferenceResponse(const InferenceRequest* request);
+  ~InferenceResponse();
+
+  // The response is deleted when the client or backend and every
+  // request input forwarding one of its outputs have released it.
+  void AddRef() { refcount_.fetch_add(1); }
+  void Release();
+
+  Model* GetModel() const { return model_; }
+  const std::string& Id() const { return id_; }
+  TRITONSERVER_Error* Error() const { return error_; }
+  const std::vector<std::unique_ptr<Output>>& Outputs() const
+  {
+    return outputs_;
+  }
+  const std::vector<Parameter>& Parameters() const { return parameters_; }
+
+  TRITONSERVER_Error* AddOutput(
+      const char* name, const TRITONSERVER_DataType datatype,
+      const int64_t* shape, const uint32_t dims_count, Output** output);
+  TRITONSERVER_Error* AddOutput(
+      const uint32_t slot, const TRITONSERVER_DataType datatype,
+      const int64_t* shape, const uint32_t dims_count, Output** output);
+  void AddParameter(Parameter&& parameter);
+
+  // Deliver the response to the response callback, transferring
+  // ownership of the response. 'error' is copied.
+  void Send(const uint32_t send_flags, TRITONSERVER_Error* error);
+
+  // Deliver 'responses' in order, transferring ownership of each. The
+  // responses whose request set a batch response callback are
+  // delivered with one call for each distinct callback. 'errors' may
+  // be nullptr, the errors are copied.
+  static void SendBatch(
+      InferenceResponse** responses, const uint32_t response_count,
+      const uint32_t* send_flags, TRITONSERVER_Error** errors);
+
+ private:
+  friend class Output;
+
+  TRITONSERVER_Error* StartAllocation();
+  void PrepareSend(TRITONSERVER_Error* error);
+
+  std::atomic<uint32_t> refcount_;
+  Model* model_;
+  const InferenceRequest* request_;
+  const std::string id_;
+  const ResponseAllocator* allocator_;
+  void* allocator_userp_;
+  TRITONSERVER_InferenceResponseCompleteFn_t response_fn_;
+  TRITONSERVER_InferenceResponseBatchCompleteFn_t response_batch_fn_;
+  void* response_userp_;
+  bool allocation_started_;
+  TRITONSERVER_Error* error_;
+  std::vector<std::unique_ptr<Output>> outputs_;
+  std::vector<Parameter> parameters_;
+};
+
+//
+// Implementation of TRITONBACKEND_ModelInstance. Each instance runs
+// one thread that executes the requests queued for the model.
+//
+class ModelInstance {
+ public:
+  ModelInstance(Model* model, const uint32_t index);
+
+  Model* GetModel() const { return model_; }
+  const std::string& Name() const { return name_; }
+  void* State() const { return state_; }
+  void SetState(void* state) { state_ = state; }
+
+  void Start();
+  void Join();
+
+ private:
+  void Run();
+
+  Model* model_;
+  const std::string name_;
+  void* state_;
+  std::thread thread_;
+};
+
+//
+// Statistics of a model.
+//
+struct StatDuration {
+  StatDuration() : count_(0), ns_(0) {}
+  void Add(const uint64_t ns)
+  {
+    count_++;
+    ns_ += ns;
+  }
+  uint64_t count_;
+  uint64_t ns_;
+};
+
+struct BatchStats {
+  StatDuration compute_input_;
+  StatDuration compute_infer_;
+  StatDuration compute_output_;
+};
+
+struct ModelStats {
+  ModelStats() : last_inference_ms_(0), inference_count_(0), execution_count_(0)
+  {
+  }
+
+  uint64_t last_inference_ms_;
+  uint64_t inference_count_;
+  uint64_t execution_count_;
+  StatDuration success_;
+  StatDuration fail_;
+  StatDuration queue_;
+  StatDuration compute_input_;
+  StatDuration compute_infer_;
+  StatDuration compute_output_;
+  std::map<uint64_t, BatchStats> batch_stats_;
+};
+
+//
+// Implementation of TRITONBACKEND_Model. The loopback server has a
+// single model with a single version.
+//
+class Model {
+ public:
+  Model(Server* server, ModelConfig* config);
+  ~Model();
+
+  Server* GetServer() const { return server_; }
+  ModelConfig* Config() const { return config_; }
+  const std::string& Name() const { return config_->Name(); }
+  int64_t Version() const { return 1; }
+  void* State() const { return state_; }
+  void SetState(void* state) { state_ = state; }
+
+  bool IsReady() const { return ready_.load(); }
+  void SetReady(bool ready) { ready_.store(ready); }
+
+  // Start and stop the instance threads. Starting a model that is
+  // ready has no effect. Start and Stop are serialized, so a model is
+  // never started while it is stopping. An instance thread cannot
+  // join itself, so called from a callback running on one of the
+  // model's instance threads Stop returns TRITONSERVER_ERROR_UNAVAILABLE,
+  // as does Start unless the model is ready.
+  TRITONSERVER_Error* Start();
+  TRITONSERVER_Error* Stop();
+
+  // Whether the calling thread is one of the model's instance threads.
+  bool OnInstanceThread() const;
+
+  // Queue requests for execution. The requests must have been
+  // prepared. Either all requests are queued or none are.
+  TRITONSERVER_Error* Enqueue(
+      InferenceRequest** requests, const uint32_t count);
+
+  // Wait for and return the next request to execute, or nullptr if
+  // the model is stopping.
+  InferenceRequest* Dequeue();
+
+  // Execute requests with the identity model, \see
+  // IdentityModelExecute.
+  void Execute(
+      ModelInstance* instance, InferenceRequest** requests,
+      const uint32_t count);
+
+  // Complete a request that can not be executed with an error
+  // response before releasing it.
+  void FailRequest(InferenceRequest* request, TRITONSERVER_Error* error);
+
+  // Statistics.
+  void ReportStatistics(
+      InferenceRequest* request, const bool success,
+      const uint64_t exec_start_ns, const uint64_t compute_start_ns,
+      const uint64_t compute_end_ns, const uint64_t exec_end_ns);
+  void ReportBatchStatistics(
+      const uint64_t batch_size, const uint64_t exec_start_ns,
+      const uint64_t compute_start_ns, const uint64_t compute_end_ns,
+      const uint64_t exec_end_ns);
+  void Statistics(ModelStats* stats, uint64_t* change_token) const;
+
+  // As Statistics but without the per-batch-size statistics, leaving
+  // 'batch_stats_' of 'stats' unchanged, so that the copy does not
+  // allocate memory.
+  void CounterStatistics(ModelStats* stats, uint64_t* change_token) const;
+
+ private:
+  Server* server_;
+  ModelConfig* config_;
+  void* state_;
+  std::atomic<bool> ready_;
+
+  // Serializes Start and Stop.
+  std::mutex lifecycle_mu_;
+
+  std::mutex queue_mu_;
+  std::condition_variable queue_cv_;
+  std::deque<InferenceRequest*> queue_;
+  bool exiting_;
+  std::vector<std::unique_ptr<ModelInstance>> instances_;
+
+  mutable std::mutex stats_mu_;
+  ModelStats stats_;
+  uint64_t stats_change_token_;
+};
+
+//
+// Implementation of TRITONSERVER_Server.
+//
+class Server {
+ public:
+  static TRITONSERVER_Error* Create(
+      const ServerOptions& options, std::unique_ptr<Server>* server);
+  ~Server();
+
+  const std::string& Id() const { return id_; }
+  bool IsLive() const { return live_.load(); }
+  bool IsReady() const;
+  bool MetricsEnabled() const { return metrics_; }
+  Model* GetModel() const { return model_.get(); }
+
+  // Find the model with a given name and version, a version of -1
+  // selecting the latest version.
+  TRITONSERVER_Error* FindModel(
+      const char* model_name, const int64_t model_version, Model** model);
+
+  TRITONSERVER_Error* LoadModel(const char* model_name);
+  TRITONSERVER_Error* UnloadModel(const char* model_name);
+
+  // Stop the server. As for Model::Stop this cannot be called from one
+  // of the model's instance threads.
+  TRITONSERVER_Error* Stop();
+
+  // Prepare and queue a batch of requests for the same model.
+  TRITONSERVER_Error* InferAsync(
+      InferenceRequest** requests, const uint32_t request_count);
+
+  TRITONSERVER_Error* RegisterMemoryRegion(
+      const void* base, const size_t byte_size, MemoryRegion** region);
+  TRITONSERVER_Error* UnregisterMemoryRegion(MemoryRegion* region);
+
+  // Return the token identifying the current state of the
+  // statistics and advance it.
+  uint64_t NextStatisticsToken() { return stats_token_.fetch_add(1) + 1; }
+  uint64_t StatisticsToken() const { return stats_token_.load(); }
+
+  std::string MetadataJson() const;
+  std::string ModelIndexJson(const uint32_t flags) const;
+  std::string ModelStatisticsJson() const;
+  std::string MetricsText() const;
+
+  // Fill the statistics record of the model and return the token of
+  // the last change to its statistics.
+  void StatisticsRecord(
+      TRITONSERVER_ModelStatisticsRecord* record,
+      uint64_t* change_token) const;
+
+ private:
+  Server(const ServerOptions& options);
+
+  // The number of instances of the model receiving requests.
+  uint64_t ActiveInstanceCount() const;
+
+  const std::string id_;
+  const bool metrics_;
+  const bool strict_readiness_;
+  std::atomic<bool> live_;
+  std::atomic<uint64_t> stats_token_;
+  std::unique_ptr<Model> model_;
+
+  std::mutex regions_mu_;
+  std::set<MemoryRegion*> regions_;
+};
+
+// Execute requests with the identity model. The model is written
+// against the TRITONBACKEND API, as a backend would be, so that the
+// execution exercises the same API calls as a real backend.
+TRITONSERVER_Error* IdentityModelExecute(
+    TRITONBACKEND_ModelInstance* instance, TRITONBACKEND_Request** requests,
+    const uint32_t request_count);
+
+}}}  // namespace triton::core::loopback
@@ -0,0 +1,3033 @@
+// Copyright 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include "loopback_server.h"
+#include "triton/core/tritonbackend.h"
+#include "triton/core/tritonrepoagent.h"
+#include "triton/core/tritonserver.h"
+
+//
+// Functional implementation of the Triton Server, Backend and
+// RepoAgent APIs that serves a single loopback "identity" model
+// in-process, \see loopback_server.h. Server options that have no
+// meaning for the loopback server are accepted and ignored. API
+// functions that depend on capabilities the loopback server does not
+// have, such as GPUs, backends, repository agents and tracing, return
+// TRITONSERVER_ERROR_UNSUPPORTED.
+//
+
+#if defined(_MSC_VER)
+#define TRITONAPI_DECLSPEC __declspec(dllexport)
+#elif defined(__GNUC__)
+#define TRITONAPI_DECLSPEC __attribute__((__visibility__("default")))
+#else
+#define TRITONAPI_DECLSPEC
+#endif
+
+namespace lb = triton::core::loopback;
+
+namespace {
+
+TRITONSERVER_Error*
+Unsupported(const char* function_name)
+{
+  return lb::TritonServerError::Create(
+      TRITONSERVER_ERROR_UNSUPPORTED,
+      std::string(function_name) + " is not supported by the loopback server");
+}
+
+TRITONSERVER_Error*
+IndexOutOfRange(const char* kind, const uint32_t index, const size_t count)
+{
+  return lb::TritonServerError::Create(
+      TRITONSERVER_ERROR_INVALID_ARG,
+      "out of bounds index " + std::to_string(index) + ": " +
+          std::to_string(count) + " " + kind + "s available");
+}
+
+}  // namespace
+
+extern "C" {
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ApiVersion(uint32_t* major, uint32_t* minor)
+{
+  *major = TRITONSERVER_API_VERSION_MAJOR;
+  *minor = TRITONSERVER_API_VERSION_MINOR;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC const char*
+TRITONSERVER_DataTypeString(TRITONSERVER_DataType datatype)
+{
+  switch (datatype) {
+    case TRITONSERVER_TYPE_BOOL:
+      return "BOOL";
+    case TRITONSERVER_TYPE_UINT8:
+      return "UINT8";
+    case TRITONSERVER_TYPE_UINT16:
+      return "UINT16";
+    case TRITONSERVER_TYPE_UINT32:
+      return "UINT32";
+    case TRITONSERVER_TYPE_UINT64:
+      return "UINT64";
+    case TRITONSERVER_TYPE_INT8:
+      return "INT8";
+    case TRITONSERVER_TYPE_INT16:
+      return "INT16";
+    case TRITONSERVER_TYPE_INT32:
+      return "INT32";
+    case TRITONSERVER_TYPE_INT64:
+      return "INT64";
+    case TRITONSERVER_TYPE_FP16:
+      return "FP16";
+    case TRITONSERVER_TYPE_FP32:
+      return "FP32";
+    case TRITONSERVER_TYPE_FP64:
+      return "FP64";
+    case TRITONSERVER_TYPE_BYTES:
+      return "BYTES";
+    default:
+      break;
+  }
+
+  return "<invalid>";
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_DataType
+TRITONSERVER_StringToDataType(const char* dtype)
+{
+  for (int datatype = TRITONSERVER_TYPE_BOOL;
+       datatype <= TRITONSERVER_TYPE_BYTES; ++datatype) {
+    const TRITONSERVER_DataType dt =
+        static_cast<TRITONSERVER_DataType>(datatype);
+    if (strcmp(dtype, TRITONSERVER_DataTypeString(dt)) == 0) {
+      return dt;
+    }
+  }
+
+  return TRITONSERVER_TYPE_INVALID;
+}
+
+TRITONAPI_DECLSPEC uint32_t
+TRITONSERVER_DataTypeByteSize(TRITONSERVER_DataType datatype)
+{
+  switch (datatype) {
+    case TRITONSERVER_TYPE_BOOL:
+    case TRITONSERVER_TYPE_INT8:
+    case TRITONSERVER_TYPE_UINT8:
+      return 1;
+    case TRITONSERVER_TYPE_INT16:
+    case TRITONSERVER_TYPE_UINT16:
+    case TRITONSERVER_TYPE_FP16:
+      return 2;
+    case TRITONSERVER_TYPE_INT32:
+    case TRITONSERVER_TYPE_UINT32:
+    case TRITONSERVER_TYPE_FP32:
+      return 4;
+    case TRITONSERVER_TYPE_INT64:
+    case TRITONSERVER_TYPE_UINT64:
+    case TRITONSERVER_TYPE_FP64:
+      return 8;
+    default:
+      break;
+  }
+
+  return 0;
+}
+
+TRITONAPI_DECLSPEC const char*
+TRITONSERVER_BytesLayoutString(TRITONSERVER_BytesLayout layout)
+{
+  switch (layout) {
+    case TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED:
+      return "LENGTH_PREFIXED";
+    case TRITONSERVER_BYTES_LAYOUT_OFFSETS:
+      return "OFFSETS";
+    default:
+      break;
+  }
+
+  return "<invalid>";
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_BytesLayoutConvert(
+    const TRITONSERVER_BytesLayout src_layout, const void* src,
+    const size_t src_byte_size, const uint64_t element_count,
+    const TRITONSERVER_BytesLayout dst_layout, void* dst,
+    const size_t dst_byte_size, size_t* converted_byte_size)
+{
+  return lb::ConvertBytesLayout(
+      src_layout, reinterpret_cast<const char*>(src), src_byte_size,
+      element_count, dst_layout, reinterpret_cast<char*>(dst), dst_byte_size,
+      converted_byte_size);
+}
+
+TRITONAPI_DECLSPEC const char*
+TRITONSERVER_MemoryTypeString(TRITONSERVER_MemoryType memtype)
+{
+  switch (memtype) {
+    case TRITONSERVER_MEMORY_CPU:
+      return "CPU";
+    case TRITONSERVER_MEMORY_CPU_PINNED:
+      return "CPU_PINNED";
+    case TRITONSERVER_MEMORY_GPU:
+      return "GPU";
+    default:
+      break;
+  }
+
+  return "<invalid>";
+}
+
+TRITONAPI_DECLSPEC const char*
+TRITONSERVER_ParameterTypeString(TRITONSERVER_ParameterType paramtype)
+{
+  switch (paramtype) {
+    case TRITONSERVER_PARAMETER_STRING:
+      return "STRING";
+    case TRITONSERVER_PARAMETER_INT:
+      return "INT";
+    case TRITONSERVER_PARAMETER_BOOL:
+      return "BOOL";
+    default:
+      break;
+  }
+
+  return "<invalid>";
+}
+
+TRITONAPI_DECLSPEC const char*
+TRITONSERVER_InstanceGroupKindString(TRITONSERVER_InstanceGroupKind kind)
+{
+  switch (kind) {
+    case TRITONSERVER_INSTANCEGROUPKIND_AUTO:
+      return "AUTO";
+    case TRITONSERVER_INSTANCEGROUPKIND_CPU:
+      return "CPU";
+    case TRITONSERVER_INSTANCEGROUPKIND_GPU:
+      return "GPU";
+    case TRITONSERVER_INSTANCEGROUPKIND_MODEL:
+      return "MODEL";
+    default:
+      break;
+  }
+
+  return "<invalid>";
+}
+
+TRITONAPI_DECLSPEC bool
+TRITONSERVER_LogIsEnabled(TRITONSERVER_LogLevel level)
+{
+  return lb::Logger::IsEnabled(level);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_LogMessage(
+    TRITONSERVER_LogLevel level, const char* filename, const int line,
+    const char* msg)
+{
+  if (lb::Logger::IsEnabled(level)) {
+    lb::Logger::Log(level, filename, line, msg);
+  }
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_LogDroppedMessageCount(uint64_t* dropped_count)
+{
+  // Messages are written synchronously and so are never dropped.
+  *dropped_count = 0;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ErrorNew(TRITONSERVER_Error_Code code, const char* msg)
+{
+  return lb::TritonServerError::Create(code, msg);
+}
+
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ErrorDelete(TRITONSERVER_Error* error)
+{
+  delete reinterpret_cast<lb::TritonServerError*>(error);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error_Code
+TRITONSERVER_ErrorCode(TRITONSERVER_Error* error)
+{
+  return reinterpret_cast<lb::TritonServerError*>(error)->Code();
+}
+
+TRITONAPI_DECLSPEC const char*
+TRITONSERVER_ErrorCodeString(TRITONSERVER_Error* error)
+{
+  switch (reinterpret_cast<lb::TritonServerError*>(error)->Code()) {
+    case TRITONSERVER_ERROR_UNKNOWN:
+      return "Unknown";
+    case TRITONSERVER_ERROR_INTERNAL:
+      return "Internal";
+    case TRITONSERVER_ERROR_NOT_FOUND:
+      return "Not found";
+    case TRITONSERVER_ERROR_INVALID_ARG:
+      return "Invalid argument";
+    case TRITONSERVER_ERROR_UNAVAILABLE:
+      return "Unavailable";
+    case TRITONSERVER_ERROR_UNSUPPORTED:
+      return "Unsupported";
+    case TRITONSERVER_ERROR_ALREADY_EXISTS:
+      return "Already exists";
+  }
+
+  return "<invalid code>";
+}
+
+TRITONAPI_DECLSPEC const char*
+TRITONSERVER_ErrorMessage(TRITONSERVER_Error* error)
+{
+  return reinterpret_cast<lb::TritonServerError*>(error)->Message().c_str();
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ResponseAllocatorNew(
+    TRITONSERVER_ResponseAllocator** allocator,
+    TRITONSERVER_ResponseAllocatorAllocFn_t alloc_fn,
+    TRITONSERVER_ResponseAllocatorReleaseFn_t release_fn,
+    TRITONSERVER_ResponseAllocatorStartFn_t start_fn)
+{
+  *allocator = reinterpret_cast<TRITONSERVER_ResponseAllocator*>(
+      new lb::ResponseAllocator{alloc_fn, release_fn, start_fn});
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ResponseAllocatorDelete(TRITONSERVER_ResponseAllocator* allocator)
+{
+  delete reinterpret_cast<lb::ResponseAllocator*>(allocator);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ResponseAllocatorNewPooled(
+    TRITONSERVER_ResponseAllocator** allocator,
+    const uint64_t max_buffer_byte_size, const uint64_t max_cached_byte_size)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ResponseAllocatorPoolStatistics(
+    TRITONSERVER_ResponseAllocator* allocator,
+    const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id,
+    uint64_t* hit_count, uint64_t* miss_count, uint64_t* cached_byte_size,
+    uint64_t* peak_byte_size)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_MemoryRegionProperties(
+    TRITONSERVER_MemoryRegion* region, const void** base, size_t* byte_size,
+    TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id)
+{
+  const lb::MemoryRegion* lregion =
+      reinterpret_cast<const lb::MemoryRegion*>(region);
+  *base = lregion->base_;
+  *byte_size = lregion->byte_size_;
+  *memory_type = TRITONSERVER_MEMORY_CPU;
+  *memory_type_id = 0;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewRelease(TRITONSERVER_ModelConfigView* view)
+{
+  reinterpret_cast<lb::ModelConfig*>(view)->Release();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewName(
+    TRITONSERVER_ModelConfigView* view, const char** model_name,
+    int64_t* model_version)
+{
+  *model_name = reinterpret_cast<lb::ModelConfig*>(view)->Name().c_str();
+  *model_version = 1;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewBackend(
+    TRITONSERVER_ModelConfigView* view, const char** backend,
+    const char** platform)
+{
+  *backend = "loopback";
+  *platform = "";
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewMaxBatchSize(
+    TRITONSERVER_ModelConfigView* view, int32_t* max_batch_size)
+{
+  *max_batch_size = 0;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewDecoupled(
+    TRITONSERVER_ModelConfigView* view, bool* decoupled)
+{
+  *decoupled = false;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewInputCount(
+    TRITONSERVER_ModelConfigView* view, uint32_t* count)
+{
+  *count = reinterpret_cast<lb::ModelConfig*>(view)->InputNames().size();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewInput(
+    TRITONSERVER_ModelConfigView* view, const uint32_t index, const char** name,
+    TRITONSERVER_DataType* datatype, const int64_t** shape,
+    uint32_t* dims_count, bool* optional)
+{
+  const lb::ModelConfig* config = reinterpret_cast<lb::ModelConfig*>(view);
+  if (index >= config->InputNames().size()) {
+    return IndexOutOfRange("input", index, config->InputNames().size());
+  }
+
+  *name = config->InputNames()[index].c_str();
+  *datatype = config->DataType();
+  *shape = config->InputShape();
+  *dims_count = 1;
+  *optional = true;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewOutputCount(
+    TRITONSERVER_ModelConfigView* view, uint32_t* count)
+{
+  *count = reinterpret_cast<lb::ModelConfig*>(view)->OutputNames().size();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewOutput(
+    TRITONSERVER_ModelConfigView* view, const uint32_t index, const char** name,
+    TRITONSERVER_DataType* datatype, const int64_t** shape,
+    uint32_t* dims_count)
+{
+  const lb::ModelConfig* config = reinterpret_cast<lb::ModelConfig*>(view);
+  if (index >= config->OutputNames().size()) {
+    return IndexOutOfRange("output", index, config->OutputNames().size());
+  }
+
+  *name = config->OutputNames()[index].c_str();
+  *datatype = config->OutputDataType();
+  *shape = config->OutputShape();
+  *dims_count = 1;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ModelConfigViewDynamicBatching(
+    TRITONSERVER_ModelConfigView* view, bool* enabled,
+    const int32_t** preferred_batch_sizes, uint32_t* preferred_batch_size_count,
+    uint64_t* max_queue_delay_us)
+{
+  *enabled = false;
+  *preferred_batch_sizes = nullptr;
+  *preferred_batch_size_count = 0;
+  *max_queue_delay_us = 0;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_MessageNewFromSerializedJson(
+    TRITONSERVER_Message** message, const char* base, size_t byte_size)
+{
+  *message = reinterpret_cast<TRITONSERVER_Message*>(
+      new lb::Message(std::string(base, byte_size)));
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_MessageDelete(TRITONSERVER_Message* message)
+{
+  delete reinterpret_cast<lb::Message*>(message);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_MessageSerializeToJson(
+    TRITONSERVER_Message* message, const char** base, size_t* byte_size)
+{
+  const std::string& serialized =
+      reinterpret_cast<lb::Message*>(message)->Serialized();
+  *base = serialized.c_str();
+  *byte_size = serialized.size();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_MetricsDelete(TRITONSERVER_Metrics* metrics)
+{
+  delete reinterpret_cast<lb::Message*>(metrics);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_MetricsFormatted(
+    TRITONSERVER_Metrics* metrics, TRITONSERVER_MetricFormat format,
+    const char** base, size_t* byte_size)
+{
+  if (format != TRITONSERVER_METRIC_PROMETHEUS) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "unknown metrics format '" + std::to_string(format) + "'");
+  }
+
+  const std::string& serialized =
+      reinterpret_cast<lb::Message*>(metrics)->Serialized();
+  *base = serialized.c_str();
+  *byte_size = serialized.size();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC const char*
+TRITONSERVER_InferenceTraceLevelString(TRITONSERVER_InferenceTraceLevel level)
+{
+  switch (level) {
+    case TRITONSERVER_TRACE_LEVEL_DISABLED:
+      return "DISABLED";
+    case TRITONSERVER_TRACE_LEVEL_MIN:
+      return "MIN";
+    case TRITONSERVER_TRACE_LEVEL_MAX:
+      return "MAX";
+  }
+
+  return "<unknown>";
+}
+
+TRITONAPI_DECLSPEC const char*
+TRITONSERVER_InferenceTraceActivityString(
+    TRITONSERVER_InferenceTraceActivity activity)
+{
+  switch (activity) {
+    case TRITONSERVER_TRACE_REQUEST_START:
+      return "REQUEST_START";
+    case TRITONSERVER_TRACE_QUEUE_START:
+      return "QUEUE_START";
+    case TRITONSERVER_TRACE_COMPUTE_START:
+      return "COMPUTE_START";
+    case TRITONSERVER_TRACE_COMPUTE_INPUT_END:
+      return "COMPUTE_INPUT_END";
+    case TRITONSERVER_TRACE_COMPUTE_OUTPUT_START:
+      return "COMPUTE_OUTPUT_START";
+    case TRITONSERVER_TRACE_COMPUTE_END:
+      return "COMPUTE_END";
+    case TRITONSERVER_TRACE_REQUEST_END:
+      return "REQUEST_END";
+  }
+
+  return "<unknown>";
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceTraceNew(
+    TRITONSERVER_InferenceTrace** trace, TRITONSERVER_InferenceTraceLevel level,
+    uint64_t parent_id, TRITONSERVER_InferenceTraceActivityFn_t activity_fn,
+    TRITONSERVER_InferenceTraceReleaseFn_t release_fn, void* trace_userp)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceTraceDelete(TRITONSERVER_InferenceTrace* trace)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceTraceId(TRITONSERVER_InferenceTrace* trace, uint64_t* id)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceTraceParentId(
+    TRITONSERVER_InferenceTrace* trace, uint64_t* parent_id)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceTraceModelName(
+    TRITONSERVER_InferenceTrace* trace, const char** model_name)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceTraceModelVersion(
+    TRITONSERVER_InferenceTrace* trace, int64_t* model_version)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestNew(
+    TRITONSERVER_InferenceRequest** inference_request,
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  lb::Model* model;
+  RETURN_IF_ERROR(lserver->FindModel(model_name, model_version, &model));
+
+  *inference_request = reinterpret_cast<TRITONSERVER_InferenceRequest*>(
+      new lb::InferenceRequest(lserver, model));
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestDelete(
+    TRITONSERVER_InferenceRequest* inference_request)
+{
+  delete reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestReset(
+    TRITONSERVER_InferenceRequest* inference_request)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->RemoveAllInputData();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestId(
+    TRITONSERVER_InferenceRequest* inference_request, const char** id)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  *id = lrequest->id_.c_str();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetId(
+    TRITONSERVER_InferenceRequest* inference_request, const char* id)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->id_ = id;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestFlags(
+    TRITONSERVER_InferenceRequest* inference_request, uint32_t* flags)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  *flags = lrequest->flags_;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetFlags(
+    TRITONSERVER_InferenceRequest* inference_request, uint32_t flags)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->flags_ = flags;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestCorrelationId(
+    TRITONSERVER_InferenceRequest* inference_request, uint64_t* correlation_id)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  if (lrequest->correlation_id_is_string_) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "given request's correlation id is not an unsigned int");
+  }
+
+  *correlation_id = lrequest->correlation_id_;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestCorrelationIdString(
+    TRITONSERVER_InferenceRequest* inference_request,
+    const char** correlation_id)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  if (!lrequest->correlation_id_is_string_) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "given request's correlation id is not a string");
+  }
+
+  *correlation_id = lrequest->correlation_id_string_.c_str();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetCorrelationId(
+    TRITONSERVER_InferenceRequest* inference_request, uint64_t correlation_id)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->correlation_id_ = correlation_id;
+  lrequest->correlation_id_is_string_ = false;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetCorrelationIdString(
+    TRITONSERVER_InferenceRequest* inference_request,
+    const char* correlation_id)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->correlation_id_string_ = correlation_id;
+  lrequest->correlation_id_is_string_ = true;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestPriority(
+    TRITONSERVER_InferenceRequest* inference_request, uint32_t* priority)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  *priority = lrequest->priority_;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetPriority(
+    TRITONSERVER_InferenceRequest* inference_request, uint32_t priority)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->priority_ = priority;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestTimeoutMicroseconds(
+    TRITONSERVER_InferenceRequest* inference_request, uint64_t* timeout_us)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  *timeout_us = lrequest->timeout_us_;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetTimeoutMicroseconds(
+    TRITONSERVER_InferenceRequest* inference_request, uint64_t timeout_us)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->timeout_us_ = timeout_us;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestAddInput(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    const TRITONSERVER_DataType datatype, const int64_t* shape,
+    uint64_t dim_count)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  return lrequest->AddInput(name, datatype, shape, dim_count);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestRemoveInput(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  return lrequest->RemoveInput(name);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestRemoveAllInputs(
+    TRITONSERVER_InferenceRequest* inference_request)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->RemoveAllInputs();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestAppendInputData(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    const void* base, size_t byte_size, TRITONSERVER_MemoryType memory_type,
+    int64_t memory_type_id)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lb::InferenceRequest::Input* input = lrequest->FindInput(name);
+  if (input == nullptr) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "input '" + std::string(name) + "' does not exist in request");
+  }
+
+  return input->AppendData(base, byte_size, memory_type, memory_type_id);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestAppendInputDataWithHostPolicy(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    const void* base, size_t byte_size, TRITONSERVER_MemoryType memory_type,
+    int64_t memory_type_id, const char* host_policy_name)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lb::InferenceRequest::Input* input = lrequest->FindInput(name);
+  if (input == nullptr) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "input '" + std::string(name) + "' does not exist in request");
+  }
+
+  // The loopback server has no host policies, all data is visible
+  // to its single host.
+  return input->AppendData(base, byte_size, memory_type, memory_type_id);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestAppendInputDataFromRegion(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    TRITONSERVER_MemoryRegion* region, size_t offset, size_t byte_size)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lb::InferenceRequest::Input* input = lrequest->FindInput(name);
+  if (input == nullptr) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "input '" + std::string(name) + "' does not exist in request");
+  }
+
+  lb::MemoryRegion* lregion = reinterpret_cast<lb::MemoryRegion*>(region);
+  if ((offset > lregion->byte_size_) ||
+      (byte_size > (lregion->byte_size_ - offset))) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "block for input '" + std::string(name) +
+            "' exceeds the size of the memory region");
+  }
+
+  RETURN_IF_ERROR(input->AppendData(
+      reinterpret_cast<const char*>(lregion->base_) + offset, byte_size,
+      TRITONSERVER_MEMORY_CPU, 0 /* memory_type_id */));
+  input->HoldRegion(lregion);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestAddInputFromResponseOutput(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    TRITONSERVER_InferenceResponse* inference_response,
+    const uint32_t output_index)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(inference_response);
+  if (lresponse->Error() != nullptr) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "cannot add input '" + std::string(name) +
+            "' from a response that failed");
+  }
+  if (output_index >= lresponse->Outputs().size()) {
+    return IndexOutOfRange(
+        "output", output_index, lresponse->Outputs().size());
+  }
+
+  const lb::InferenceResponse::Output* output =
+      lresponse->Outputs()[output_index].get();
+  RETURN_IF_ERROR(lrequest->AddInput(
+      name, output->DataType(), output->Shape().data(),
+      output->Shape().size()));
+
+  lb::InferenceRequest::Input* input = lrequest->FindInput(name);
+  input->SetBytesLayout(output->BytesLayout());
+  TRITONSERVER_Error* err = input->AppendData(
+      output->Base(), output->ByteSize(), output->MemoryType(),
+      output->MemoryTypeId());
+  if (err != nullptr) {
+    lrequest->RemoveInput(name);
+    return err;
+  }
+
+  // The response holds a reference to the memory region of any
+  // region-backed output, so holding the response also keeps that
+  // region registered while the input references its data.
+  input->HoldResponse(lresponse);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestRemoveAllInputData(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lb::InferenceRequest::Input* input = lrequest->FindInput(name);
+  if (input == nullptr) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "input '" + std::string(name) + "' does not exist in request");
+  }
+
+  input->RemoveAllData();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetInputBytesLayout(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    const TRITONSERVER_BytesLayout layout)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lb::InferenceRequest::Input* input = lrequest->FindInput(name);
+  if (input == nullptr) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "input '" + std::string(name) + "' does not exist in request");
+  }
+  if (input->DataType() != TRITONSERVER_TYPE_BYTES) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "input '" + std::string(name) + "' does not have datatype BYTES");
+  }
+
+  input->SetBytesLayout(layout);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestAddRequestedOutput(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  return lrequest->AddRequestedOutput(name);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetRequestedOutputRegion(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    TRITONSERVER_MemoryRegion* region, size_t offset, size_t byte_size)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  return lrequest->SetRequestedOutputRegion(
+      name, reinterpret_cast<lb::MemoryRegion*>(region), offset, byte_size);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetRequestedOutputBytesLayout(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name,
+    const TRITONSERVER_BytesLayout layout)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  return lrequest->SetRequestedOutputBytesLayout(name, layout);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestRemoveRequestedOutput(
+    TRITONSERVER_InferenceRequest* inference_request, const char* name)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  return lrequest->RemoveRequestedOutput(name);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestRemoveAllRequestedOutputs(
+    TRITONSERVER_InferenceRequest* inference_request)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->RemoveAllRequestedOutputs();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetReleaseCallback(
+    TRITONSERVER_InferenceRequest* inference_request,
+    TRITONSERVER_InferenceRequestReleaseFn_t request_release_fn,
+    void* request_release_userp)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->release_fn_ = request_release_fn;
+  lrequest->release_userp_ = request_release_userp;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetResponseCallback(
+    TRITONSERVER_InferenceRequest* inference_request,
+    TRITONSERVER_ResponseAllocator* response_allocator,
+    void* response_allocator_userp,
+    TRITONSERVER_InferenceResponseCompleteFn_t response_fn,
+    void* response_userp)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->allocator_ =
+      reinterpret_cast<const lb::ResponseAllocator*>(response_allocator);
+  lrequest->allocator_userp_ = response_allocator_userp;
+  lrequest->response_fn_ = response_fn;
+  lrequest->response_batch_fn_ = nullptr;
+  lrequest->response_userp_ = response_userp;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetResponseBatchCallback(
+    TRITONSERVER_InferenceRequest* inference_request,
+    TRITONSERVER_ResponseAllocator* response_allocator,
+    void* response_allocator_userp,
+    TRITONSERVER_InferenceResponseBatchCompleteFn_t response_fn,
+    void* response_userp)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  lrequest->allocator_ =
+      reinterpret_cast<const lb::ResponseAllocator*>(response_allocator);
+  lrequest->allocator_userp_ = response_allocator_userp;
+  lrequest->response_fn_ = nullptr;
+  lrequest->response_batch_fn_ = response_fn;
+  lrequest->response_userp_ = response_userp;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceRequestSetResponseCoalescing(
+    TRITONSERVER_InferenceRequest* inference_request,
+    const uint64_t window_us)
+{
+  // The loopback server has no response factories, so it never sends
+  // the non-final responses a coalescing window would hold.
+  if (window_us != 0) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_UNSUPPORTED,
+        "response coalescing is not supported by the loopback server");
+  }
+
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseDelete(
+    TRITONSERVER_InferenceResponse* inference_response)
+{
+  reinterpret_cast<lb::InferenceResponse*>(inference_response)->Release();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseError(
+    TRITONSERVER_InferenceResponse* inference_response)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(inference_response);
+  if (lresponse->Error() == nullptr) {
+    return nullptr;  // success
+  }
+
+  return TRITONSERVER_ErrorNew(
+      TRITONSERVER_ErrorCode(lresponse->Error()),
+      TRITONSERVER_ErrorMessage(lresponse->Error()));
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseModel(
+    TRITONSERVER_InferenceResponse* inference_response, const char** model_name,
+    int64_t* model_version)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(inference_response);
+  *model_name = lresponse->GetModel()->Name().c_str();
+  *model_version = lresponse->GetModel()->Version();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseId(
+    TRITONSERVER_InferenceResponse* inference_response, const char** request_id)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(inference_response);
+  *request_id = lresponse->Id().c_str();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseParameterCount(
+    TRITONSERVER_InferenceResponse* inference_response, uint32_t* count)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(inference_response);
+  *count = lresponse->Parameters().size();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseParameter(
+    TRITONSERVER_InferenceResponse* inference_response, const uint32_t index,
+    const char** name, TRITONSERVER_ParameterType* type, const void** vvalue)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(inference_response);
+  const auto& parameters = lresponse->Parameters();
+  if (index >= parameters.size()) {
+    return IndexOutOfRange("parameter", index, parameters.size());
+  }
+
+  const lb::InferenceResponse::Parameter& parameter = parameters[index];
+  *name = parameter.name_.c_str();
+  *type = parameter.type_;
+  switch (parameter.type_) {
+    case TRITONSERVER_PARAMETER_STRING:
+      *vvalue = parameter.string_value_.c_str();
+      break;
+    case TRITONSERVER_PARAMETER_INT:
+      *vvalue = &parameter.int_value_;
+      break;
+    case TRITONSERVER_PARAMETER_BOOL:
+      *vvalue = &parameter.bool_value_;
+      break;
+  }
+
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseOutputCount(
+    TRITONSERVER_InferenceResponse* inference_response, uint32_t* count)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(inference_response);
+  *count = lresponse->Outputs().size();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseOutput(
+    TRITONSERVER_InferenceResponse* inference_response, const uint32_t index,
+    const char** name, TRITONSERVER_DataType* datatype, const int64_t** shape,
+    uint64_t* dim_count, const void** base, size_t* byte_size,
+    TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id, void** userp)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(inference_response);
+  const auto& outputs = lresponse->Outputs();
+  if (index >= outputs.size()) {
+    return IndexOutOfRange("output", index, outputs.size());
+  }
+
+  const lb::InferenceResponse::Output& output = *outputs[index];
+  *name = output.Name().c_str();
+  *datatype = output.DataType();
+  *shape = output.Shape().data();
+  *dim_count = output.Shape().size();
+  *base = output.Base();
+  *byte_size = output.ByteSize();
+  *memory_type = output.MemoryType();
+  *memory_type_id = output.MemoryTypeId();
+  *userp = output.BufferUserp();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseOutputBytesLayout(
+    TRITONSERVER_InferenceResponse* inference_response, const uint32_t index,
+    TRITONSERVER_BytesLayout* layout)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(inference_response);
+  const auto& outputs = lresponse->Outputs();
+  if (index >= outputs.size()) {
+    return IndexOutOfRange("output", index, outputs.size());
+  }
+
+  *layout = outputs[index]->BytesLayout();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_InferenceResponseOutputClassificationLabel(
+    TRITONSERVER_InferenceResponse* inference_response, const uint32_t index,
+    const size_t class_index, const char** label)
+{
+  // The identity model has no labels.
+  *label = nullptr;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsNew(TRITONSERVER_ServerOptions** options)
+{
+  *options =
+      reinterpret_cast<TRITONSERVER_ServerOptions*>(new lb::ServerOptions());
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsDelete(TRITONSERVER_ServerOptions* options)
+{
+  delete reinterpret_cast<lb::ServerOptions*>(options);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetServerId(
+    TRITONSERVER_ServerOptions* options, const char* server_id)
+{
+  lb::ServerOptions* loptions =
+      reinterpret_cast<lb::ServerOptions*>(options);
+  loptions->server_id_ = server_id;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelRepositoryPath(
+    TRITONSERVER_ServerOptions* options, const char* model_repository_path)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelControlMode(
+    TRITONSERVER_ServerOptions* options, TRITONSERVER_ModelControlMode mode)
+{
+  lb::ServerOptions* loptions =
+      reinterpret_cast<lb::ServerOptions*>(options);
+  loptions->model_control_mode_ = mode;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelRepositoryPollMode(
+    TRITONSERVER_ServerOptions* options, TRITONSERVER_RepositoryPollMode mode)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelRepositoryCacheDirectory(
+    TRITONSERVER_ServerOptions* options, const char* cache_dir)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelRepositoryCacheByteSize(
+    TRITONSERVER_ServerOptions* options, uint64_t size)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelRepositoryDownloadParallelism(
+    TRITONSERVER_ServerOptions* options, unsigned int thread_count,
+    uint64_t part_byte_size)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetStartupModel(
+    TRITONSERVER_ServerOptions* options, const char* model_name)
+{
+  lb::ServerOptions* loptions =
+      reinterpret_cast<lb::ServerOptions*>(options);
+  loptions->startup_models_.emplace_back(model_name);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelLoadThreadCount(
+    TRITONSERVER_ServerOptions* options, unsigned int thread_count)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelLoadGpuMemoryLimit(
+    TRITONSERVER_ServerOptions* options, int gpu_device, uint64_t size)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetStrictModelConfig(
+    TRITONSERVER_ServerOptions* options, bool strict)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetRateLimiterMode(
+    TRITONSERVER_ServerOptions* options, TRITONSERVER_RateLimitMode mode)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelInstanceActivation(
+    TRITONSERVER_ServerOptions* options, const char* model_name,
+    const uint32_t activate_queue_depth,
+    const uint64_t activate_queue_delay_us,
+    const uint32_t deactivate_queue_depth,
+    const uint64_t deactivate_queue_delay_us, const uint64_t hysteresis_ms)
+{
+  if (model_name == nullptr) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "model name for instance activation must not be null");
+  }
+  if (((activate_queue_depth != 0) &&
+       (deactivate_queue_depth > activate_queue_depth)) ||
+      ((activate_queue_delay_us != 0) &&
+       (deactivate_queue_delay_us > activate_queue_delay_us))) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "deactivation thresholds for model '" + std::string(model_name) +
+            "' must not exceed activation thresholds");
+  }
+
+  // The identity model has no passive instances so there is nothing
+  // to activate.
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsAddRateLimiterResource(
+    TRITONSERVER_ServerOptions* options, const char* resource_name,
+    const size_t resource_count, const int device)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetPinnedMemoryPoolByteSize(
+    TRITONSERVER_ServerOptions* options, uint64_t size)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetNumaPinnedMemoryPoolByteSize(
+    TRITONSERVER_ServerOptions* options, int numa_node, uint64_t size)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetCudaMemoryPoolByteSize(
+    TRITONSERVER_ServerOptions* options, int gpu_device, uint64_t size)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetCudaMemoryPoolLimit(
+    TRITONSERVER_ServerOptions* options, int gpu_device, uint64_t max_size)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetSequenceStateSpillTimeout(
+    TRITONSERVER_ServerOptions* options, uint64_t idle_timeout_us)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetResponseCacheByteSize(
+    TRITONSERVER_ServerOptions* options, uint64_t size)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetResponseCacheShardCount(
+    TRITONSERVER_ServerOptions* options, uint32_t shard_count)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetModelResponseCache(
+    TRITONSERVER_ServerOptions* options, const char* model_name, bool enable,
+    uint64_t byte_size, uint64_t ttl_ms)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetMinSupportedComputeCapability(
+    TRITONSERVER_ServerOptions* options, double cc)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetExitOnError(
+    TRITONSERVER_ServerOptions* options, bool exit)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetStrictReadiness(
+    TRITONSERVER_ServerOptions* options, bool strict)
+{
+  lb::ServerOptions* loptions =
+      reinterpret_cast<lb::ServerOptions*>(options);
+  loptions->strict_readiness_ = strict;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetExitTimeout(
+    TRITONSERVER_ServerOptions* options, unsigned int timeout)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetBufferManagerThreadCount(
+    TRITONSERVER_ServerOptions* options, unsigned int thread_count)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetLogInfo(
+    TRITONSERVER_ServerOptions* options, bool log)
+{
+  lb::ServerOptions* loptions =
+      reinterpret_cast<lb::ServerOptions*>(options);
+  loptions->log_info_ = log;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetLogWarn(
+    TRITONSERVER_ServerOptions* options, bool log)
+{
+  lb::ServerOptions* loptions =
+      reinterpret_cast<lb::ServerOptions*>(options);
+  loptions->log_warn_ = log;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetLogError(
+    TRITONSERVER_ServerOptions* options, bool log)
+{
+  lb::ServerOptions* loptions =
+      reinterpret_cast<lb::ServerOptions*>(options);
+  loptions->log_error_ = log;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetLogVerbose(
+    TRITONSERVER_ServerOptions* options, int level)
+{
+  lb::ServerOptions* loptions =
+      reinterpret_cast<lb::ServerOptions*>(options);
+  loptions->log_verbose_ = level;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetLogAsync(
+    TRITONSERVER_ServerOptions* options, bool enable,
+    uint32_t buffer_entry_count)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetLogRateLimit(
+    TRITONSERVER_ServerOptions* options, uint32_t burst_count,
+    uint64_t interval_ms)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetMetrics(
+    TRITONSERVER_ServerOptions* options, bool metrics)
+{
+  lb::ServerOptions* loptions =
+      reinterpret_cast<lb::ServerOptions*>(options);
+  loptions->metrics_ = metrics;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetGpuMetrics(
+    TRITONSERVER_ServerOptions* options, bool gpu_metrics)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetMetricsInterval(
+    TRITONSERVER_ServerOptions* options, uint64_t metrics_interval_ms)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetLatencyHistograms(
+    TRITONSERVER_ServerOptions* options, bool enable, uint32_t precision_bits)
+{
+  if (precision_bits > 7) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "latency histogram precision must be in the range [0, 7], got " +
+            std::to_string(precision_bits));
+  }
+
+  // The loopback server does not record latency histograms, so the
+  // statistics and metrics it returns never hold them.
+  if (enable) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_UNSUPPORTED,
+        "latency histograms are not supported by the loopback server");
+  }
+
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetTraceSampling(
+    TRITONSERVER_ServerOptions* options, TRITONSERVER_InferenceTraceLevel level,
+    uint32_t sample_rate, uint32_t buffer_record_count)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetTraceRecordsCallback(
+    TRITONSERVER_ServerOptions* options,
+    TRITONSERVER_InferenceTraceRecordsFn_t records_fn, void* records_userp,
+    uint64_t interval_ms)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetBackendDirectory(
+    TRITONSERVER_ServerOptions* options, const char* backend_dir)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetRepoAgentDirectory(
+    TRITONSERVER_ServerOptions* options, const char* repoagent_dir)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetBackendConfig(
+    TRITONSERVER_ServerOptions* options, const char* backend_name,
+    const char* setting, const char* value)
+{
+  lb::ServerOptions* loptions =
+      reinterpret_cast<lb::ServerOptions*>(options);
+  // Only the configuration of the loopback backend is meaningful, the
+  // configuration of any other backend is ignored.
+  if (strcmp(backend_name, "loopback") == 0) {
+    loptions->loopback_config_[setting] = value;
+  }
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetHostPolicy(
+    TRITONSERVER_ServerOptions* options, const char* policy_name,
+    const char* setting, const char* value)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerOptionsSetAutoNumaHostPolicy(
+    TRITONSERVER_ServerOptions* options, bool enable)
+{
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerNew(
+    TRITONSERVER_Server** server, TRITONSERVER_ServerOptions* options)
+{
+  std::unique_ptr<lb::Server> lserver;
+  RETURN_IF_ERROR(lb::Server::Create(
+      *reinterpret_cast<lb::ServerOptions*>(options), &lserver));
+
+  *server = reinterpret_cast<TRITONSERVER_Server*>(lserver.release());
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerDelete(TRITONSERVER_Server* server)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  RETURN_IF_ERROR(lserver->Stop());
+  delete lserver;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerStop(TRITONSERVER_Server* server)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  return lserver->Stop();
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerPollModelRepository(TRITONSERVER_Server* server)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerIsLive(TRITONSERVER_Server* server, bool* live)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  *live = lserver->IsLive();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerIsReady(TRITONSERVER_Server* server, bool* ready)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  *ready = lserver->IsReady();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelIsReady(
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version, bool* ready)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  lb::Model* model;
+  TRITONSERVER_Error* err =
+      lserver->FindModel(model_name, model_version, &model);
+  if (err != nullptr) {
+    TRITONSERVER_ErrorDelete(err);
+    *ready = false;
+    return nullptr;  // success
+  }
+
+  *ready = model->IsReady();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelBatchProperties(
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version, uint32_t* flags, void** voidp)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  lb::Model* model;
+  RETURN_IF_ERROR(lserver->FindModel(model_name, model_version, &model));
+
+  // The identity model does not support batching.
+  *flags = TRITONSERVER_BATCH_UNKNOWN;
+  if (voidp != nullptr) {
+    *voidp = nullptr;
+  }
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelTransactionProperties(
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version, uint32_t* txn_flags, void** voidp)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  lb::Model* model;
+  RETURN_IF_ERROR(lserver->FindModel(model_name, model_version, &model));
+
+  *txn_flags = TRITONSERVER_TXN_ONE_TO_ONE;
+  if (voidp != nullptr) {
+    *voidp = nullptr;
+  }
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerMetadata(
+    TRITONSERVER_Server* server, TRITONSERVER_Message** server_metadata)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  *server_metadata = reinterpret_cast<TRITONSERVER_Message*>(
+      new lb::Message(lserver->MetadataJson()));
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelMetadata(
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version, TRITONSERVER_Message** model_metadata)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  lb::Model* model;
+  RETURN_IF_ERROR(lserver->FindModel(model_name, model_version, &model));
+
+  *model_metadata = reinterpret_cast<TRITONSERVER_Message*>(
+      new lb::Message(model->Config()->MetadataJson()));
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelStatistics(
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version, TRITONSERVER_Message** model_stats)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  if (strlen(model_name) != 0) {
+    lb::Model* model;
+    RETURN_IF_ERROR(lserver->FindModel(model_name, model_version, &model));
+  }
+
+  *model_stats = reinterpret_cast<TRITONSERVER_Message*>(
+      new lb::Message(lserver->ModelStatisticsJson()));
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelStatisticsSnapshot(
+    TRITONSERVER_Server* server, const uint64_t since_token,
+    TRITONSERVER_ModelStatisticsRecord* records, const uint32_t record_capacity,
+    const size_t record_byte_size, uint32_t* record_count,
+    uint64_t* snapshot_token)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  const size_t min_record_byte_size =
+      offsetof(TRITONSERVER_ModelStatisticsRecord, compute_output_ns) +
+      sizeof(uint64_t);
+  if ((record_byte_size < min_record_byte_size) ||
+      (record_byte_size > sizeof(TRITONSERVER_ModelStatisticsRecord))) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "unexpected statistics record size " +
+            std::to_string(record_byte_size));
+  }
+
+  const uint64_t token = lserver->StatisticsToken();
+
+  TRITONSERVER_ModelStatisticsRecord record;
+  uint64_t change_token;
+  lserver->StatisticsRecord(&record, &change_token);
+
+  uint32_t count = 0;
+  if (lserver->GetModel()->IsReady() &&
+      ((since_token == 0) || (change_token > since_token))) {
+    count = 1;
+  }
+  if (count > record_capacity) {
+    *record_count = count;
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_UNAVAILABLE,
+        "statistics require " + std::to_string(count) + " records");
+  }
+
+  // Copy only the part of the record known to the caller.
+  if (count > 0) {
+    memcpy(records, &record, record_byte_size);
+  }
+  *record_count = count;
+  *snapshot_token = token;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerTraceRecords(
+    TRITONSERVER_Server* server, TRITONSERVER_InferenceTraceRecord* records,
+    const uint32_t record_capacity, const size_t record_byte_size,
+    uint32_t* record_count, uint64_t* dropped_count)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelConfig(
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version, const uint32_t config_version,
+    TRITONSERVER_Message** model_config)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  lb::Model* model;
+  RETURN_IF_ERROR(lserver->FindModel(model_name, model_version, &model));
+
+  if (config_version != 1) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_UNSUPPORTED,
+        "model configuration version " + std::to_string(config_version) +
+            " not supported, supported versions are: 1");
+  }
+
+  *model_config = reinterpret_cast<TRITONSERVER_Message*>(
+      new lb::Message(model->Config()->ConfigJson()));
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelConfigView(
+    TRITONSERVER_Server* server, const char* model_name,
+    const int64_t model_version, TRITONSERVER_ModelConfigView** view)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  lb::Model* model;
+  RETURN_IF_ERROR(lserver->FindModel(model_name, model_version, &model));
+
+  model->Config()->AddRef();
+  *view = reinterpret_cast<TRITONSERVER_ModelConfigView*>(model->Config());
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerModelIndex(
+    TRITONSERVER_Server* server, uint32_t flags,
+    TRITONSERVER_Message** model_index)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  *model_index = reinterpret_cast<TRITONSERVER_Message*>(
+      new lb::Message(lserver->ModelIndexJson(flags)));
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerLoadModel(
+    TRITONSERVER_Server* server, const char* model_name)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  return lserver->LoadModel(model_name);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerUnloadModel(
+    TRITONSERVER_Server* server, const char* model_name)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  return lserver->UnloadModel(model_name);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerUnloadModelAndDependents(
+    TRITONSERVER_Server* server, const char* model_name)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  // The identity model has no dependents.
+  return lserver->UnloadModel(model_name);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerMetrics(
+    TRITONSERVER_Server* server, TRITONSERVER_Metrics** metrics)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  if (!lserver->MetricsEnabled()) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_UNSUPPORTED, "metrics not supported");
+  }
+
+  *metrics = reinterpret_cast<TRITONSERVER_Metrics*>(
+      new lb::Message(lserver->MetricsText()));
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerRegisterMemoryRegion(
+    TRITONSERVER_Server* server, TRITONSERVER_MemoryRegion** region,
+    const TRITONSERVER_MemoryRegionKind kind, const void* base,
+    const size_t byte_size, const int64_t memory_type_id)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  if (kind != TRITONSERVER_MEMORY_REGION_SYSTEM) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_UNSUPPORTED,
+        "only system memory regions are supported by the loopback server");
+  }
+
+  lb::MemoryRegion* lregion;
+  RETURN_IF_ERROR(lserver->RegisterMemoryRegion(base, byte_size, &lregion));
+  *region = reinterpret_cast<TRITONSERVER_MemoryRegion*>(lregion);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerUnregisterMemoryRegion(
+    TRITONSERVER_Server* server, TRITONSERVER_MemoryRegion* region)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  return lserver->UnregisterMemoryRegion(
+      reinterpret_cast<lb::MemoryRegion*>(region));
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerInferAsync(
+    TRITONSERVER_Server* server,
+    TRITONSERVER_InferenceRequest* inference_request,
+    TRITONSERVER_InferenceTrace* trace)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  // Traces can not be created with the loopback server so 'trace' is
+  // always nullptr.
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(inference_request);
+  return lserver->InferAsync(&lrequest, 1);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONSERVER_ServerInferAsyncBatch(
+    TRITONSERVER_Server* server,
+    TRITONSERVER_InferenceRequest** inference_requests,
+    const uint32_t request_count, TRITONSERVER_InferenceTrace** traces)
+{
+  lb::Server* lserver = reinterpret_cast<lb::Server*>(server);
+  return lserver->InferAsync(
+      reinterpret_cast<lb::InferenceRequest**>(inference_requests),
+      request_count);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ApiVersion(uint32_t* major, uint32_t* minor)
+{
+  *major = TRITONBACKEND_API_VERSION_MAJOR;
+  *minor = TRITONBACKEND_API_VERSION_MINOR;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_MemoryManagerAllocate(
+    TRITONBACKEND_MemoryManager* manager, void** buffer,
+    const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id,
+    const uint64_t byte_size)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_MemoryManagerFree(
+    TRITONBACKEND_MemoryManager* manager, void* buffer,
+    const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_MemoryManagerAllocateAsync(
+    TRITONBACKEND_MemoryManager* manager, void** buffer,
+    const int64_t memory_type_id, const uint64_t byte_size, void* cuda_stream)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_MemoryManagerFreeAsync(
+    TRITONBACKEND_MemoryManager* manager, void* buffer,
+    const int64_t memory_type_id, void* cuda_stream)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_InputProperties(
+    TRITONBACKEND_Input* input, const char** name,
+    TRITONSERVER_DataType* datatype, const int64_t** shape,
+    uint32_t* dims_count, uint64_t* byte_size, uint32_t* buffer_count)
+{
+  const lb::InferenceRequest::Input* linput =
+      reinterpret_cast<lb::InferenceRequest::Input*>(input);
+  if (name != nullptr) {
+    *name = linput->Name().c_str();
+  }
+  if (datatype != nullptr) {
+    *datatype = linput->DataType();
+  }
+  if (shape != nullptr) {
+    *shape = linput->Shape().data();
+  }
+  if (dims_count != nullptr) {
+    *dims_count = linput->Shape().size();
+  }
+  if (byte_size != nullptr) {
+    *byte_size = linput->ByteSize();
+  }
+  if (buffer_count != nullptr) {
+    *buffer_count = linput->Buffers().size();
+  }
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_InputPropertiesForHostPolicy(
+    TRITONBACKEND_Input* input, const char* host_policy_name, const char** name,
+    TRITONSERVER_DataType* datatype, const int64_t** shape,
+    uint32_t* dims_count, uint64_t* byte_size, uint32_t* buffer_count)
+{
+  // The loopback server has no host policies, all data is visible to
+  // its single host.
+  const lb::InferenceRequest::Input* linput =
+      reinterpret_cast<lb::InferenceRequest::Input*>(input);
+  if (name != nullptr) {
+    *name = linput->Name().c_str();
+  }
+  if (datatype != nullptr) {
+    *datatype = linput->DataType();
+  }
+  if (shape != nullptr) {
+    *shape = linput->Shape().data();
+  }
+  if (dims_count != nullptr) {
+    *dims_count = linput->Shape().size();
+  }
+  if (byte_size != nullptr) {
+    *byte_size = linput->ByteSize();
+  }
+  if (buffer_count != nullptr) {
+    *buffer_count = linput->Buffers().size();
+  }
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_InputBuffer(
+    TRITONBACKEND_Input* input, const uint32_t index, const void** buffer,
+    uint64_t* buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
+    int64_t* memory_type_id)
+{
+  const lb::InferenceRequest::Input* linput =
+      reinterpret_cast<lb::InferenceRequest::Input*>(input);
+  if (index >= linput->Buffers().size()) {
+    return IndexOutOfRange("buffer", index, linput->Buffers().size());
+  }
+
+  const lb::InferenceRequest::Buffer& lbuffer = linput->Buffers()[index];
+  *buffer = lbuffer.base_;
+  *buffer_byte_size = lbuffer.byte_size_;
+  *memory_type = lbuffer.memory_type_;
+  *memory_type_id = lbuffer.memory_type_id_;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_InputBufferAsync(
+    TRITONBACKEND_Input* input, const uint32_t index, const void** buffer,
+    uint64_t* buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
+    int64_t* memory_type_id, void* cuda_stream, void** cuda_event)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_InputBufferForHostPolicy(
+    TRITONBACKEND_Input* input, const char* host_policy_name,
+    const uint32_t index, const void** buffer, uint64_t* buffer_byte_size,
+    TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id)
+{
+  const lb::InferenceRequest::Input* linput =
+      reinterpret_cast<lb::InferenceRequest::Input*>(input);
+  if (index >= linput->Buffers().size()) {
+    return IndexOutOfRange("buffer", index, linput->Buffers().size());
+  }
+
+  const lb::InferenceRequest::Buffer& lbuffer = linput->Buffers()[index];
+  *buffer = lbuffer.base_;
+  *buffer_byte_size = lbuffer.byte_size_;
+  *memory_type = lbuffer.memory_type_;
+  *memory_type_id = lbuffer.memory_type_id_;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_InputBufferForHostPolicyAsync(
+    TRITONBACKEND_Input* input, const char* host_policy_name,
+    const uint32_t index, const void** buffer, uint64_t* buffer_byte_size,
+    TRITONSERVER_MemoryType* memory_type, int64_t* memory_type_id,
+    void* cuda_stream, void** cuda_event)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_InputBytesLayout(
+    TRITONBACKEND_Input* input, TRITONSERVER_BytesLayout* layout)
+{
+  const lb::InferenceRequest::Input* linput =
+      reinterpret_cast<lb::InferenceRequest::Input*>(input);
+  if (linput->DataType() != TRITONSERVER_TYPE_BYTES) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "input '" + linput->Name() + "' does not have datatype BYTES");
+  }
+
+  *layout = linput->BytesLayout();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_InputSetBytesLayout(
+    TRITONBACKEND_Input* input, const TRITONSERVER_BytesLayout layout)
+{
+  lb::InferenceRequest::Input* linput =
+      reinterpret_cast<lb::InferenceRequest::Input*>(input);
+  if (linput->DataType() != TRITONSERVER_TYPE_BYTES) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "input '" + linput->Name() + "' does not have datatype BYTES");
+  }
+
+  return linput->SetBackendBytesLayout(layout);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_OutputBuffer(
+    TRITONBACKEND_Output* output, void** buffer,
+    const uint64_t buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
+    int64_t* memory_type_id)
+{
+  return reinterpret_cast<lb::InferenceResponse::Output*>(output)
+      ->AllocateBuffer(buffer, buffer_byte_size, memory_type, memory_type_id);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_OutputBufferAsync(
+    TRITONBACKEND_Output* output, void** buffer,
+    const uint64_t buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
+    int64_t* memory_type_id, void* cuda_stream)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_OutputBytesLayout(
+    TRITONBACKEND_Output* output, TRITONSERVER_BytesLayout* layout)
+{
+  const lb::InferenceResponse::Output* loutput =
+      reinterpret_cast<lb::InferenceResponse::Output*>(output);
+  if (loutput->DataType() != TRITONSERVER_TYPE_BYTES) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "output '" + loutput->Name() + "' does not have datatype BYTES");
+  }
+
+  *layout = loutput->BytesLayout();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestId(TRITONBACKEND_Request* request, const char** id)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  *id = lrequest->id_.c_str();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestCorrelationId(TRITONBACKEND_Request* request, uint64_t* id)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  if (lrequest->correlation_id_is_string_) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "correlation id in request is not an unsigned int");
+  }
+
+  *id = lrequest->correlation_id_;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestCorrelationIdString(
+    TRITONBACKEND_Request* request, const char** id)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  if (!lrequest->correlation_id_is_string_) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "correlation id in request is not a string");
+  }
+
+  *id = lrequest->correlation_id_string_.c_str();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestInputCount(TRITONBACKEND_Request* request, uint32_t* count)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  *count = lrequest->Inputs().size();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestInputName(
+    TRITONBACKEND_Request* request, const uint32_t index,
+    const char** input_name)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  const auto& inputs = lrequest->Inputs();
+  if (index >= inputs.size()) {
+    return IndexOutOfRange("input", index, inputs.size());
+  }
+
+  *input_name = inputs[index]->Name().c_str();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestInput(
+    TRITONBACKEND_Request* request, const char* name,
+    TRITONBACKEND_Input** input)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  lb::InferenceRequest::Input* linput = lrequest->FindInput(name);
+  if (linput == nullptr) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_INVALID_ARG,
+        "unknown request input name " + std::string(name));
+  }
+
+  *input = reinterpret_cast<TRITONBACKEND_Input*>(linput);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestInputByIndex(
+    TRITONBACKEND_Request* request, const uint32_t index,
+    TRITONBACKEND_Input** input)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  const auto& inputs = lrequest->Inputs();
+  if (index >= inputs.size()) {
+    return IndexOutOfRange("input", index, inputs.size());
+  }
+
+  *input = reinterpret_cast<TRITONBACKEND_Input*>(inputs[index].get());
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestInputBySlot(
+    TRITONBACKEND_Request* request, const uint32_t slot,
+    TRITONBACKEND_Input** input)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  *input = reinterpret_cast<TRITONBACKEND_Input*>(lrequest->SlotInput(slot));
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestOutputCount(
+    TRITONBACKEND_Request* request, uint32_t* count)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  *count = lrequest->RequestedOutputs().size();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestOutputName(
+    TRITONBACKEND_Request* request, const uint32_t index,
+    const char** output_name)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  const auto& outputs = lrequest->RequestedOutputs();
+  if (index >= outputs.size()) {
+    return IndexOutOfRange("requested output", index, outputs.size());
+  }
+
+  *output_name = outputs[index].name_.c_str();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestOutputRequestedBySlot(
+    TRITONBACKEND_Request* request, const uint32_t slot, bool* requested)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  *requested = lrequest->SlotOutputRequested(slot);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestRelease(
+    TRITONBACKEND_Request* request, uint32_t release_flags)
+{
+  lb::InferenceRequest* lrequest =
+      reinterpret_cast<lb::InferenceRequest*>(request);
+  lrequest->Release(release_flags);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestsGatherInput(
+    TRITONBACKEND_Request** requests, const uint32_t request_count,
+    const char* name, const char* host_policy_name, void* buffer,
+    const uint64_t buffer_byte_size, const TRITONSERVER_MemoryType memory_type,
+    const int64_t memory_type_id, void* cuda_stream,
+    uint64_t* request_byte_offsets, const void** contiguous_buffer,
+    bool* cuda_copy)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_RequestState(
+    TRITONBACKEND_Request* request, const char* name,
+    TRITONBACKEND_Input** state)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_StateNew(
+    TRITONBACKEND_State** state, TRITONBACKEND_Request* request,
+    const char* name, const TRITONSERVER_DataType datatype,
+    const int64_t* shape, const uint32_t dims_count)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_StateBuffer(
+    TRITONBACKEND_State* state, void** buffer,
+    const uint64_t buffer_byte_size, TRITONSERVER_MemoryType* memory_type,
+    int64_t* memory_type_id)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_StateUpdate(TRITONBACKEND_State* state)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseFactoryNew(
+    TRITONBACKEND_ResponseFactory** factory, TRITONBACKEND_Request* request)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseFactoryDelete(TRITONBACKEND_ResponseFactory* factory)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseFactorySendFlags(
+    TRITONBACKEND_ResponseFactory* factory, const uint32_t send_flags)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseNew(
+    TRITONBACKEND_Response** response, TRITONBACKEND_Request* request)
+{
+  *response = reinterpret_cast<TRITONBACKEND_Response*>(
+      new lb::InferenceResponse(
+          reinterpret_cast<lb::InferenceRequest*>(request)));
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseNewFromFactory(
+    TRITONBACKEND_Response** response, TRITONBACKEND_ResponseFactory* factory)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseDelete(TRITONBACKEND_Response* response)
+{
+  reinterpret_cast<lb::InferenceResponse*>(response)->Release();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseSetStringParameter(
+    TRITONBACKEND_Response* response, const char* name, const char* value)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(response);
+  lresponse->AddParameter(lb::InferenceResponse::Parameter{
+      name, TRITONSERVER_PARAMETER_STRING, value, 0, false});
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseSetIntParameter(
+    TRITONBACKEND_Response* response, const char* name, const int64_t value)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(response);
+  lresponse->AddParameter(lb::InferenceResponse::Parameter{
+      name, TRITONSERVER_PARAMETER_INT, std::string(), value, false});
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseSetBoolParameter(
+    TRITONBACKEND_Response* response, const char* name, const bool value)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(response);
+  lresponse->AddParameter(lb::InferenceResponse::Parameter{
+      name, TRITONSERVER_PARAMETER_BOOL, std::string(), 0, value});
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseOutput(
+    TRITONBACKEND_Response* response, TRITONBACKEND_Output** output,
+    const char* name, const TRITONSERVER_DataType datatype,
+    const int64_t* shape, const uint32_t dims_count)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(response);
+  lb::InferenceResponse::Output* loutput;
+  RETURN_IF_ERROR(
+      lresponse->AddOutput(name, datatype, shape, dims_count, &loutput));
+  *output = reinterpret_cast<TRITONBACKEND_Output*>(loutput);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseOutputBySlot(
+    TRITONBACKEND_Response* response, TRITONBACKEND_Output** output,
+    const uint32_t slot, const TRITONSERVER_DataType datatype,
+    const int64_t* shape, const uint32_t dims_count)
+{
+  lb::InferenceResponse* lresponse =
+      reinterpret_cast<lb::InferenceResponse*>(response);
+  lb::InferenceResponse::Output* loutput;
+  RETURN_IF_ERROR(
+      lresponse->AddOutput(slot, datatype, shape, dims_count, &loutput));
+  *output = reinterpret_cast<TRITONBACKEND_Output*>(loutput);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponsesScatterOutput(
+    TRITONBACKEND_Response** responses, const uint32_t response_count,
+    const char* name, const TRITONSERVER_DataType datatype,
+    const int64_t* shapes, const uint32_t dims_count, const void* buffer,
+    const uint64_t buffer_byte_size, const TRITONSERVER_MemoryType memory_type,
+    const int64_t memory_type_id, void* cuda_stream, bool* cuda_copy)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseSend(
+    TRITONBACKEND_Response* response, const uint32_t send_flags,
+    TRITONSERVER_Error* error)
+{
+  reinterpret_cast<lb::InferenceResponse*>(response)->Send(send_flags, error);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ResponseSendBatch(
+    TRITONBACKEND_Response** responses, const uint32_t response_count,
+    const uint32_t* send_flags, TRITONSERVER_Error** errors)
+{
+  lb::InferenceResponse::SendBatch(
+      reinterpret_cast<lb::InferenceResponse**>(responses), response_count,
+      send_flags, errors);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_BackendName(TRITONBACKEND_Backend* backend, const char** name)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_BackendConfig(
+    TRITONBACKEND_Backend* backend, TRITONSERVER_Message** backend_config)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_BackendExecutionPolicy(
+    TRITONBACKEND_Backend* backend, TRITONBACKEND_ExecutionPolicy* policy)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_BackendSetExecutionPolicy(
+    TRITONBACKEND_Backend* backend, TRITONBACKEND_ExecutionPolicy policy)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_BackendArtifacts(
+    TRITONBACKEND_Backend* backend, TRITONBACKEND_ArtifactType* artifact_type,
+    const char** location)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_BackendMemoryManager(
+    TRITONBACKEND_Backend* backend, TRITONBACKEND_MemoryManager** manager)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_BackendState(TRITONBACKEND_Backend* backend, void** state)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_BackendSetState(TRITONBACKEND_Backend* backend, void* state)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelName(TRITONBACKEND_Model* model, const char** name)
+{
+  lb::Model* lmodel = reinterpret_cast<lb::Model*>(model);
+  *name = lmodel->Name().c_str();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelVersion(TRITONBACKEND_Model* model, uint64_t* version)
+{
+  lb::Model* lmodel = reinterpret_cast<lb::Model*>(model);
+  *version = lmodel->Version();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelRepository(
+    TRITONBACKEND_Model* model, TRITONBACKEND_ArtifactType* artifact_type,
+    const char** location)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelArtifactCount(TRITONBACKEND_Model* model, uint32_t* count)
+{
+  // The identity model has no repository and so no artifacts.
+  *count = 0;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelArtifact(
+    TRITONBACKEND_Model* model, const uint32_t index, const char** name,
+    const void** base, int* fd, size_t* byte_size)
+{
+  return IndexOutOfRange("artifact", index, 0);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelConfig(
+    TRITONBACKEND_Model* model, const uint32_t config_version,
+    TRITONSERVER_Message** model_config)
+{
+  lb::Model* lmodel = reinterpret_cast<lb::Model*>(model);
+  if (config_version != 1) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_UNSUPPORTED,
+        "model configuration version " + std::to_string(config_version) +
+            " not supported, supported versions are: 1");
+  }
+
+  *model_config = reinterpret_cast<TRITONSERVER_Message*>(
+      new lb::Message(lmodel->Config()->ConfigJson()));
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelConfigView(
+    TRITONBACKEND_Model* model, TRITONSERVER_ModelConfigView** view)
+{
+  lb::Model* lmodel = reinterpret_cast<lb::Model*>(model);
+  *view = reinterpret_cast<TRITONSERVER_ModelConfigView*>(lmodel->Config());
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelAutoCompleteConfig(
+    TRITONBACKEND_Model* model, bool* auto_complete_config)
+{
+  *auto_complete_config = false;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelSetConfig(
+    TRITONBACKEND_Model* model, const uint32_t config_version,
+    TRITONSERVER_Message* model_config)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInputSlot(
+    TRITONBACKEND_Model* model, const char* name, uint32_t* slot)
+{
+  lb::Model* lmodel = reinterpret_cast<lb::Model*>(model);
+  if (!lmodel->Config()->InputSlot(name, slot)) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_NOT_FOUND, "unknown input '" + std::string(name) +
+                                          "' for model '" + lmodel->Name() +
+                                          "'");
+  }
+
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelOutputSlot(
+    TRITONBACKEND_Model* model, const char* name, uint32_t* slot)
+{
+  lb::Model* lmodel = reinterpret_cast<lb::Model*>(model);
+  if (!lmodel->Config()->OutputSlot(name, slot)) {
+    return lb::TritonServerError::Create(
+        TRITONSERVER_ERROR_NOT_FOUND, "unknown output '" + std::string(name) +
+                                          "' for model '" + lmodel->Name() +
+                                          "'");
+  }
+
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelServer(
+    TRITONBACKEND_Model* model, TRITONSERVER_Server** server)
+{
+  lb::Model* lmodel = reinterpret_cast<lb::Model*>(model);
+  *server = reinterpret_cast<TRITONSERVER_Server*>(lmodel->GetServer());
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelBackend(
+    TRITONBACKEND_Model* model, TRITONBACKEND_Backend** backend)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelState(TRITONBACKEND_Model* model, void** state)
+{
+  lb::Model* lmodel = reinterpret_cast<lb::Model*>(model);
+  *state = lmodel->State();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelSetState(TRITONBACKEND_Model* model, void* state)
+{
+  lb::Model* lmodel = reinterpret_cast<lb::Model*>(model);
+  lmodel->SetState(state);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceName(
+    TRITONBACKEND_ModelInstance* instance, const char** name)
+{
+  lb::ModelInstance* linstance = reinterpret_cast<lb::ModelInstance*>(instance);
+  *name = linstance->Name().c_str();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceKind(
+    TRITONBACKEND_ModelInstance* instance, TRITONSERVER_InstanceGroupKind* kind)
+{
+  *kind = TRITONSERVER_INSTANCEGROUPKIND_CPU;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceDeviceId(
+    TRITONBACKEND_ModelInstance* instance, int32_t* device_id)
+{
+  *device_id = 0;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceCudaStream(
+    TRITONBACKEND_ModelInstance* instance, void** stream)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceHostPolicy(
+    TRITONBACKEND_ModelInstance* instance, TRITONSERVER_Message** host_policy)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceIsPassive(
+    TRITONBACKEND_ModelInstance* instance, bool* is_passive)
+{
+  *is_passive = false;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceIsActive(
+    TRITONBACKEND_ModelInstance* instance, bool* is_active)
+{
+  *is_active = true;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceProfileCount(
+    TRITONBACKEND_ModelInstance* instance, uint32_t* count)
+{
+  *count = 0;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceProfileName(
+    TRITONBACKEND_ModelInstance* instance, const uint32_t index,
+    const char** profile_name)
+{
+  return IndexOutOfRange("profile", index, 0);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceSecondaryDeviceCount(
+    TRITONBACKEND_ModelInstance* instance, uint32_t* count)
+{
+  *count = 0;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceSecondaryDeviceProperties(
+    TRITONBACKEND_ModelInstance* instance, uint32_t index, const char** kind,
+    int64_t* id)
+{
+  return IndexOutOfRange("secondary device", index, 0);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceModel(
+    TRITONBACKEND_ModelInstance* instance, TRITONBACKEND_Model** model)
+{
+  lb::ModelInstance* linstance = reinterpret_cast<lb::ModelInstance*>(instance);
+  *model = reinterpret_cast<TRITONBACKEND_Model*>(linstance->GetModel());
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceState(
+    TRITONBACKEND_ModelInstance* instance, void** state)
+{
+  lb::ModelInstance* linstance = reinterpret_cast<lb::ModelInstance*>(instance);
+  *state = linstance->State();
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceSetState(
+    TRITONBACKEND_ModelInstance* instance, void* state)
+{
+  lb::ModelInstance* linstance = reinterpret_cast<lb::ModelInstance*>(instance);
+  linstance->SetState(state);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceSetExecutionDepth(
+    TRITONBACKEND_ModelInstance* instance, const uint32_t depth)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceExecution(
+    TRITONBACKEND_ModelInstance* instance, TRITONBACKEND_Execution** execution)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceArenaAllocate(
+    TRITONBACKEND_ModelInstance* instance, void** buffer,
+    const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id,
+    const uint64_t byte_size)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceArenaAllocateAsync(
+    TRITONBACKEND_ModelInstance* instance, void** buffer,
+    const int64_t memory_type_id, const uint64_t byte_size, void* cuda_stream)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceArenaUsage(
+    TRITONBACKEND_ModelInstance* instance,
+    const TRITONSERVER_MemoryType memory_type, const int64_t memory_type_id,
+    uint64_t* reserved_byte_size, uint64_t* peak_byte_size)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceReportStatistics(
+    TRITONBACKEND_ModelInstance* instance, TRITONBACKEND_Request* request,
+    const bool success, const uint64_t exec_start_ns,
+    const uint64_t compute_start_ns, const uint64_t compute_end_ns,
+    const uint64_t exec_end_ns)
+{
+  lb::ModelInstance* linstance = reinterpret_cast<lb::ModelInstance*>(instance);
+  linstance->GetModel()->ReportStatistics(
+      reinterpret_cast<lb::InferenceRequest*>(request), success,
+      exec_start_ns, compute_start_ns, compute_end_ns, exec_end_ns);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ModelInstanceReportBatchStatistics(
+    TRITONBACKEND_ModelInstance* instance, const uint64_t batch_size,
+    const uint64_t exec_start_ns, const uint64_t compute_start_ns,
+    const uint64_t compute_end_ns, const uint64_t exec_end_ns)
+{
+  lb::ModelInstance* linstance = reinterpret_cast<lb::ModelInstance*>(instance);
+  linstance->GetModel()->ReportBatchStatistics(
+      batch_size, exec_start_ns, compute_start_ns, compute_end_ns,
+      exec_end_ns);
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ExecutionComplete(TRITONBACKEND_Execution* execution)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONBACKEND_ExecutionCompleteOnEvent(
+    TRITONBACKEND_Execution* execution, void* cuda_event)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ApiVersion(uint32_t* major, uint32_t* minor)
+{
+  *major = TRITONREPOAGENT_API_VERSION_MAJOR;
+  *minor = TRITONREPOAGENT_API_VERSION_MINOR;
+  return nullptr;  // success
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelRepositoryLocation(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    TRITONREPOAGENT_ArtifactType* artifact_type, const char** location)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelRepositoryLocationAcquire(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    const TRITONREPOAGENT_ArtifactType artifact_type, const char** location)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelRepositoryLocationRelease(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    const char* location)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelRepositoryUpdate(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    const TRITONREPOAGENT_ArtifactType artifact_type, const char* location)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelRepositoryUpdateMemory(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    const char** names, const void** bases, const size_t* byte_sizes,
+    const uint32_t artifact_count)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelRepositoryUpdateFileDescriptor(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    const char** names, const int* fds, const size_t* byte_sizes,
+    const uint32_t artifact_count)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelParameterCount(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    uint32_t* count)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelParameter(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    const uint32_t index, const char** parameter_name,
+    const char** parameter_value)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelConfig(
+    TRITONREPOAGENT_Agent* agent, TRITONREPOAGENT_AgentModel* model,
+    const uint32_t config_version, TRITONSERVER_Message** model_config)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelState(TRITONREPOAGENT_AgentModel* model, void** state)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_ModelSetState(TRITONREPOAGENT_AgentModel* model, void* state)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_State(TRITONREPOAGENT_Agent* agent, void** state)
+{
+  return Unsupported(__func__);
+}
+
+TRITONAPI_DECLSPEC TRITONSERVER_Error*
+TRITONREPOAGENT_SetState(TRITONREPOAGENT_Agent* agent, void* state)
+{
+  return Unsupported(__func__);
+}
+
+}  // extern "C"
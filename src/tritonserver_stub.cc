@@ -50,6 +50,14 @@ TRITONSERVER_DataTypeByteSize()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_BytesLayoutString()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_BytesLayoutConvert()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_MemoryTypeString()
 {
 }
@@ -70,6 +78,10 @@ TRITONSERVER_LogMessage()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_LogDroppedMessageCount()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ErrorNew()
 {
 }
@@ -98,6 +110,58 @@ TRITONSERVER_ResponseAllocatorDelete()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ResponseAllocatorNewPooled()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ResponseAllocatorPoolStatistics()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_MemoryRegionProperties()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ModelConfigViewRelease()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ModelConfigViewName()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ModelConfigViewBackend()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ModelConfigViewMaxBatchSize()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ModelConfigViewDecoupled()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ModelConfigViewInputCount()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ModelConfigViewInput()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ModelConfigViewOutputCount()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ModelConfigViewOutput()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ModelConfigViewDynamicBatching()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_MessageNewFromSerializedJson()
 {
 }
@@ -158,6 +222,10 @@ TRITONSERVER_InferenceRequestDelete()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestReset()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceRequestId()
 {
 }
@@ -226,14 +294,34 @@ TRITONSERVER_InferenceRequestAppendInputDataWithHostPolicy()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestAppendInputDataFromRegion()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestAddInputFromResponseOutput()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceRequestRemoveAllInputData()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestSetInputBytesLayout()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceRequestAddRequestedOutput()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestSetRequestedOutputRegion()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestSetRequestedOutputBytesLayout()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceRequestRemoveRequestedOutput()
 {
 }
@@ -250,6 +338,14 @@ TRITONSERVER_InferenceRequestSetResponseCallback()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestSetResponseBatchCallback()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceRequestSetResponseCoalescing()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceResponseDelete()
 {
 }
@@ -282,6 +378,10 @@ TRITONSERVER_InferenceResponseOutput()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_InferenceResponseOutputBytesLayout()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_InferenceResponseOutputClassificationLabel()
 {
 }
@@ -306,10 +406,34 @@ TRITONSERVER_ServerOptionsSetModelControlMode()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelRepositoryPollMode()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelRepositoryCacheDirectory()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelRepositoryCacheByteSize()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelRepositoryDownloadParallelism()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerOptionsSetStartupModel()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelLoadThreadCount()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelLoadGpuMemoryLimit()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerOptionsSetStrictModelConfig()
 {
 }
@@ -318,6 +442,10 @@ TRITONSERVER_ServerOptionsSetRateLimiterMode()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelInstanceActivation()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerOptionsAddRateLimiterResource()
 {
 }
@@ -326,14 +454,34 @@ TRITONSERVER_ServerOptionsSetPinnedMemoryPoolByteSize()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetNumaPinnedMemoryPoolByteSize()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerOptionsSetCudaMemoryPoolByteSize()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetCudaMemoryPoolLimit()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetSequenceStateSpillTimeout()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerOptionsSetResponseCacheByteSize()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetResponseCacheShardCount()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetModelResponseCache()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerOptionsSetMinSupportedComputeCapability()
 {
 }
@@ -366,6 +514,14 @@ TRITONSERVER_ServerOptionsSetLogVerbose()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetLogAsync()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetLogRateLimit()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerOptionsSetMetrics()
 {
 }
@@ -378,6 +534,18 @@ TRITONSERVER_ServerOptionsSetMetricsInterval()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetLatencyHistograms()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetTraceSampling()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetTraceRecordsCallback()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerOptionsSetBackendDirectory()
 {
 }
@@ -394,6 +562,10 @@ TRITONSERVER_ServerOptionsSetHostPolicy()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerOptionsSetAutoNumaHostPolicy()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerNew()
 {
 }
@@ -442,10 +614,22 @@ TRITONSERVER_ServerModelStatistics()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerModelStatisticsSnapshot()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerTraceRecords()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerModelConfig()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerModelConfigView()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerModelIndex()
 {
 }
@@ -466,10 +650,22 @@ TRITONSERVER_ServerMetrics()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerRegisterMemoryRegion()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerUnregisterMemoryRegion()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONSERVER_ServerInferAsync()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONSERVER_ServerInferAsyncBatch()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ApiVersion()
 {
 }
@@ -482,6 +678,14 @@ TRITONBACKEND_MemoryManagerFree()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_MemoryManagerAllocateAsync()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_MemoryManagerFreeAsync()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_InputProperties()
 {
 }
@@ -494,14 +698,38 @@ TRITONBACKEND_InputBuffer()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_InputBufferAsync()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_InputBufferForHostPolicy()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_InputBufferForHostPolicyAsync()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_InputBytesLayout()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_InputSetBytesLayout()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_OutputBuffer()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_OutputBufferAsync()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_OutputBytesLayout()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_RequestId()
 {
 }
@@ -530,6 +758,10 @@ TRITONBACKEND_RequestInputByIndex()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_RequestInputBySlot()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_RequestOutputCount()
 {
 }
@@ -538,10 +770,34 @@ TRITONBACKEND_RequestOutputName()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_RequestOutputRequestedBySlot()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_RequestRelease()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_RequestsGatherInput()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_RequestState()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_StateNew()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_StateBuffer()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_StateUpdate()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ResponseFactoryNew()
 {
 }
@@ -582,10 +838,22 @@ TRITONBACKEND_ResponseOutput()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ResponseOutputBySlot()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_ResponsesScatterOutput()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ResponseSend()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ResponseSendBatch()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_BackendName()
 {
 }
@@ -630,10 +898,22 @@ TRITONBACKEND_ModelRepository()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelArtifactCount()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelArtifact()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ModelConfig()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelConfigView()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ModelAutoCompleteConfig()
 {
 }
@@ -642,6 +922,14 @@ TRITONBACKEND_ModelSetConfig()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelInputSlot()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelOutputSlot()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ModelServer()
 {
 }
@@ -670,10 +958,18 @@ TRITONBACKEND_ModelInstanceDeviceId()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelInstanceCudaStream()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ModelInstanceIsPassive()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelInstanceIsActive()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ModelInstanceProfileCount()
 {
 }
@@ -706,6 +1002,26 @@ TRITONBACKEND_ModelInstanceSetState()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelInstanceSetExecutionDepth()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelInstanceExecution()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelInstanceArenaAllocate()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelInstanceArenaAllocateAsync()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_ModelInstanceArenaUsage()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONBACKEND_ModelInstanceReportStatistics()
 {
 }
@@ -714,6 +1030,14 @@ TRITONBACKEND_ModelInstanceReportBatchStatistics()
 {
 }
 TRITONAPI_DECLSPEC void
+TRITONBACKEND_ExecutionComplete()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONBACKEND_ExecutionCompleteOnEvent()
+{
+}
+TRITONAPI_DECLSPEC void
 TRITONREPOAGENT_ApiVersion()
 {
 }
@@ -736,6 +1060,14 @@ TRITONAPI_DECLSPEC void
 TRITONREPOAGENT_ModelRepositoryUpdate()
 {
 }
+TRITONAPI_DECLSPEC void
+TRITONREPOAGENT_ModelRepositoryUpdateMemory()
+{
+}
+TRITONAPI_DECLSPEC void
+TRITONREPOAGENT_ModelRepositoryUpdateFileDescriptor()
+{
+}
 
 TRITONAPI_DECLSPEC void
 TRITONREPOAGENT_ModelParameterCount()
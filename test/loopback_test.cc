@@ -0,0 +1,627 @@
+// Copyright 2021, NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of NVIDIA CORPORATION nor the names of its
+//    contributors may be used to endorse or promote products derived
+//    from this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS ``AS IS'' AND ANY
+// EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR
+// PURPOSE ARE DISCLAIMED.  IN NO EVENT SHALL THE COPYRIGHT OWNER OR
+// CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+// PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY
+// OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+//
+// Functional tests of the loopback server library.
+//
+// Usage: triton-core-loopback-test [<test name>]
+//
+// Runs the named test, or all tests if no name is given, and exits
+// with a non-zero status if any test fails. Each test is also
+// registered with ctest by name.
+//
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "triton/core/tritonserver.h"
+
+namespace {
+
+#define FAIL_IF_ERR(X, MSG)                                        \
+  do {                                                             \
+    TRITONSERVER_Error* err__ = (X);                               \
+    if (err__ != nullptr) {                                        \
+      fprintf(                                                     \
+          stderr, "%s:%d: %s: %s - %s\n", __FILE__, __LINE__,      \
+          (MSG), TRITONSERVER_ErrorCodeString(err__),              \
+          TRITONSERVER_ErrorMessage(err__));                       \
+      TRITONSERVER_ErrorDelete(err__);                             \
+      exit(1);                                                     \
+    }                                                              \
+  } while (false)
+
+#define FAIL_IF_NOT(X, MSG)                                            \
+  do {                                                                 \
+    if (!(X)) {                                                        \
+      fprintf(                                                         \
+          stderr, "%s:%d: %s: %s\n", __FILE__, __LINE__, (MSG), #X);   \
+      exit(1);                                                         \
+    }                                                                  \
+  } while (false)
+
+// Whether 'err' is an error with 'code'. 'err' is deleted.
+bool
+IsError(TRITONSERVER_Error* err, const TRITONSERVER_Error_Code code)
+{
+  if (err == nullptr) {
+    return false;
+  }
+
+  const bool match = (TRITONSERVER_ErrorCode(err) == code);
+  TRITONSERVER_ErrorDelete(err);
+  return match;
+}
+
+TRITONSERVER_Error*
+ResponseAlloc(
+    TRITONSERVER_ResponseAllocator* allocator, const char* tensor_name,
+    size_t byte_size, TRITONSERVER_MemoryType preferred_memory_type,
+    int64_t preferred_memory_type_id, void* userp, void** buffer,
+    void** buffer_userp, TRITONSERVER_MemoryType* actual_memory_type,
+    int64_t* actual_memory_type_id)
+{
+  *buffer = malloc((byte_size == 0) ? 1 : byte_size);
+  *buffer_userp = nullptr;
+  *actual_memory_type = TRITONSERVER_MEMORY_CPU;
+  *actual_memory_type_id = 0;
+  return nullptr;  // success
+}
+
+TRITONSERVER_Error*
+ResponseRelease(
+    TRITONSERVER_ResponseAllocator* allocator, void* buffer,
+    void* buffer_userp, size_t byte_size, TRITONSERVER_MemoryType memory_type,
+    int64_t memory_type_id)
+{
+  free(buffer);
+  return nullptr;  // success
+}
+
+//
+// Completion of one in-flight request, signalled by the release and
+// response callbacks. 'on_response_' if set is called on the thread
+// that delivers the response.
+//
+struct Completion {
+  Completion() : released_(false), response_(nullptr) {}
+
+  TRITONSERVER_InferenceResponse* Wait()
+  {
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [this] { return released_ && (response_ != nullptr); });
+    return response_;
+  }
+
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool released_;
+  TRITONSERVER_InferenceResponse* response_;
+  std::function<void()> on_response_;
+};
+
+void
+RequestRelease(
+    TRITONSERVER_InferenceRequest* request, const uint32_t flags, void* userp)
+{
+  Completion* completion = reinterpret_cast<Completion*>(userp);
+  {
+    std::lock_guard<std::mutex> lock(completion->mu_);
+    completion->released_ = true;
+  }
+  completion->cv_.notify_one();
+}
+
+void
+ResponseComplete(
+    TRITONSERVER_InferenceResponse* response, const uint32_t flags,
+    void* userp)
+{
+  Completion* completion = reinterpret_cast<Completion*>(userp);
+  if (completion->on_response_) {
+    completion->on_response_();
+  }
+  {
+    std::lock_guard<std::mutex> lock(completion->mu_);
+    completion->response_ = response;
+  }
+  completion->cv_.notify_one();
+}
+
+//
+// A server with the loopback model configured by 'settings', and a
+// malloc response allocator.
+//
+using Settings = std::vector<std::pair<std::string, std::string>>;
+
+class Environment {
+ public:
+  explicit Environment(const Settings& settings = Settings())
+  {
+    TRITONSERVER_ServerOptions* options;
+    FAIL_IF_ERR(TRITONSERVER_ServerOptionsNew(&options), "creating options");
+    FAIL_IF_ERR(
+        TRITONSERVER_ServerOptionsSetLogInfo(options, false),
+        "disabling info logging");
+    for (const auto& setting : settings) {
+      FAIL_IF_ERR(
+          TRITONSERVER_ServerOptionsSetBackendConfig(
+              options, "loopback", setting.first.c_str(),
+              setting.second.c_str()),
+          "setting loopback backend config");
+    }
+    FAIL_IF_ERR(TRITONSERVER_ServerNew(&server_, options), "creating server");
+    FAIL_IF_ERR(
+        TRITONSERVER_ServerOptionsDelete(options), "deleting options");
+    FAIL_IF_ERR(
+        TRITONSERVER_ResponseAllocatorNew(
+            &allocator_, ResponseAlloc, ResponseRelease,
+            nullptr /* start_fn */),
+        "creating response allocator");
+  }
+
+  ~Environment()
+  {
+    FAIL_IF_ERR(
+        TRITONSERVER_ResponseAllocatorDelete(allocator_),
+        "deleting response allocator");
+    FAIL_IF_ERR(TRITONSERVER_ServerDelete(server_), "deleting server");
+  }
+
+  // Create a request for the loopback model with one input.
+  TRITONSERVER_InferenceRequest* CreateRequest(
+      const TRITONSERVER_DataType datatype, const int64_t element_count)
+  {
+    TRITONSERVER_InferenceRequest* request;
+    FAIL_IF_ERR(
+        TRITONSERVER_InferenceRequestNew(&request, server_, "loopback", -1),
+        "creating request");
+    FAIL_IF_ERR(
+        TRITONSERVER_InferenceRequestAddInput(
+            request, "INPUT0", datatype, &element_count, 1),
+        "adding input");
+    return request;
+  }
+
+  // Send 'request' and return immediately, 'completion' is signalled
+  // when it completes.
+  void InferAsync(
+      TRITONSERVER_InferenceRequest* request, Completion* completion)
+  {
+    FAIL_IF_ERR(
+        TRITONSERVER_InferenceRequestSetReleaseCallback(
+            request, RequestRelease, completion),
+        "setting release callback");
+    FAIL_IF_ERR(
+        TRITONSERVER_InferenceRequestSetResponseCallback(
+            request, allocator_, nullptr /* allocator_userp */,
+            ResponseComplete, completion),
+        "setting response callback");
+    FAIL_IF_ERR(
+        TRITONSERVER_ServerInferAsync(server_, request, nullptr /* trace */),
+        "running inference");
+  }
+
+  TRITONSERVER_Server* server_;
+  TRITONSERVER_ResponseAllocator* allocator_;
+};
+
+// Return the data of output 0 of a successful response.
+std::string
+OutputData(TRITONSERVER_InferenceResponse* response)
+{
+  FAIL_IF_ERR(TRITONSERVER_InferenceResponseError(response), "response");
+  uint32_t count;
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceResponseOutputCount(response, &count),
+      "getting output count");
+  FAIL_IF_NOT(count == 1, "unexpected output count");
+
+  const char* name;
+  TRITONSERVER_DataType datatype;
+  const int64_t* shape;
+  uint64_t dim_count;
+  const void* base;
+  size_t byte_size;
+  TRITONSERVER_MemoryType memory_type;
+  int64_t memory_type_id;
+  void* userp;
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceResponseOutput(
+          response, 0, &name, &datatype, &shape, &dim_count, &base,
+          &byte_size, &memory_type, &memory_type_id, &userp),
+      "getting output");
+  return std::string(reinterpret_cast<const char*>(base), byte_size);
+}
+
+// Encode 'elements' in the length-prefixed BYTES layout.
+std::string
+LengthPrefixed(const std::vector<std::string>& elements)
+{
+  std::string data;
+  for (const auto& element : elements) {
+    const uint32_t len = element.size();
+    for (int i = 0; i < 4; ++i) {
+      data.push_back(static_cast<char>((len >> (8 * i)) & 0xff));
+    }
+    data.append(element);
+  }
+  return data;
+}
+
+// Encode 'elements' in the offsets BYTES layout.
+std::string
+Offsets(const std::vector<std::string>& elements)
+{
+  std::string data, payload;
+  uint64_t offset = 0;
+  for (size_t e = 0; e <= elements.size(); ++e) {
+    for (int i = 0; i < 8; ++i) {
+      data.push_back(static_cast<char>((offset >> (8 * i)) & 0xff));
+    }
+    if (e < elements.size()) {
+      offset += elements[e].size();
+      payload.append(elements[e]);
+    }
+  }
+  return data + payload;
+}
+
+std::string
+Convert(
+    const TRITONSERVER_BytesLayout src_layout, const std::string& src,
+    const uint64_t element_count, const TRITONSERVER_BytesLayout dst_layout)
+{
+  size_t byte_size;
+  FAIL_IF_ERR(
+      TRITONSERVER_BytesLayoutConvert(
+          src_layout, src.data(), src.size(), element_count, dst_layout,
+          nullptr /* dst */, 0, &byte_size),
+      "getting converted size");
+  std::string dst(byte_size, '\0');
+  FAIL_IF_ERR(
+      TRITONSERVER_BytesLayoutConvert(
+          src_layout, src.data(), src.size(), element_count, dst_layout,
+          &dst[0], dst.size(), &byte_size),
+      "converting");
+  FAIL_IF_NOT(byte_size == dst.size(), "unexpected converted size");
+  return dst;
+}
+
+//
+// Tests
+//
+
+// A request sent with TRITONSERVER_ServerInferAsync is released and
+// its response echoes the input.
+void
+TestInferAsyncRoundTrip()
+{
+  Environment env;
+  const std::string data("0123456789abcdef");
+  TRITONSERVER_InferenceRequest* request =
+      env.CreateRequest(TRITONSERVER_TYPE_UINT8, data.size());
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestAppendInputData(
+          request, "INPUT0", data.data(), data.size(), TRITONSERVER_MEMORY_CPU,
+          0 /* memory_type_id */),
+      "appending input data");
+
+  // The request and the response allocator can be reused.
+  for (int i = 0; i < 2; ++i) {
+    Completion completion;
+    env.InferAsync(request, &completion);
+    TRITONSERVER_InferenceResponse* response = completion.Wait();
+    FAIL_IF_NOT(OutputData(response) == data, "output does not echo input");
+    FAIL_IF_ERR(
+        TRITONSERVER_InferenceResponseDelete(response), "deleting response");
+  }
+
+  FAIL_IF_ERR(TRITONSERVER_InferenceRequestDelete(request), "deleting request");
+}
+
+// A memory region holding the input data or the output block of a
+// request cannot be unregistered while the request or its response
+// references it, including while the request is executing.
+void
+TestUnregisterRegionInFlight()
+{
+  Environment env(Settings{{"compute-delay-us", "100000"}});
+  std::vector<char> input(64, 7), output(64, 0);
+  TRITONSERVER_MemoryRegion* input_region;
+  TRITONSERVER_MemoryRegion* output_region;
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerRegisterMemoryRegion(
+          env.server_, &input_region, TRITONSERVER_MEMORY_REGION_SYSTEM,
+          input.data(), input.size(), 0 /* memory_type_id */),
+      "registering input region");
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerRegisterMemoryRegion(
+          env.server_, &output_region, TRITONSERVER_MEMORY_REGION_SYSTEM,
+          output.data(), output.size(), 0 /* memory_type_id */),
+      "registering output region");
+
+  TRITONSERVER_InferenceRequest* request =
+      env.CreateRequest(TRITONSERVER_TYPE_UINT8, input.size());
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestAppendInputDataFromRegion(
+          request, "INPUT0", input_region, 0, input.size()),
+      "appending input data");
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestAddRequestedOutput(request, "OUTPUT0"),
+      "requesting output");
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestSetRequestedOutputRegion(
+          request, "OUTPUT0", output_region, 0, output.size()),
+      "setting output region");
+
+  Completion completion;
+  env.InferAsync(request, &completion);
+  FAIL_IF_NOT(
+      IsError(
+          TRITONSERVER_ServerUnregisterMemoryRegion(env.server_, input_region),
+          TRITONSERVER_ERROR_UNAVAILABLE),
+      "input region unregistered while in flight");
+  FAIL_IF_NOT(
+      IsError(
+          TRITONSERVER_ServerUnregisterMemoryRegion(env.server_, output_region),
+          TRITONSERVER_ERROR_UNAVAILABLE),
+      "output region unregistered while in flight");
+
+  TRITONSERVER_InferenceResponse* response = completion.Wait();
+  FAIL_IF_NOT(
+      OutputData(response) == std::string(input.data(), input.size()),
+      "output does not echo input");
+  FAIL_IF_NOT(output == input, "output region does not hold the output");
+
+  // The request still references both regions after it is released.
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestRemoveAllInputData(request, "INPUT0"),
+      "removing input data");
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerUnregisterMemoryRegion(env.server_, input_region),
+      "unregistering input region");
+  FAIL_IF_ERR(TRITONSERVER_InferenceRequestDelete(request), "deleting request");
+
+  // The response still references the output region.
+  FAIL_IF_NOT(
+      IsError(
+          TRITONSERVER_ServerUnregisterMemoryRegion(env.server_, output_region),
+          TRITONSERVER_ERROR_UNAVAILABLE),
+      "output region unregistered while referenced by response");
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceResponseDelete(response), "deleting response");
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerUnregisterMemoryRegion(env.server_, output_region),
+      "unregistering output region");
+}
+
+// Unloading the model, or stopping or deleting the server, from a
+// callback running on a model instance thread fails instead of the
+// thread joining itself, and the model can be unloaded afterwards.
+void
+TestUnloadFromInstanceThread()
+{
+  Environment env;
+  std::atomic<int> unavailable(0);
+  Completion completion;
+  completion.on_response_ = [&env, &unavailable] {
+    if (IsError(
+            TRITONSERVER_ServerUnloadModel(env.server_, "loopback"),
+            TRITONSERVER_ERROR_UNAVAILABLE)) {
+      unavailable++;
+    }
+    if (IsError(
+            TRITONSERVER_ServerStop(env.server_),
+            TRITONSERVER_ERROR_UNAVAILABLE)) {
+      unavailable++;
+    }
+    if (IsError(
+            TRITONSERVER_ServerDelete(env.server_),
+            TRITONSERVER_ERROR_UNAVAILABLE)) {
+      unavailable++;
+    }
+  };
+
+  const char data[4] = {1, 2, 3, 4};
+  TRITONSERVER_InferenceRequest* request =
+      env.CreateRequest(TRITONSERVER_TYPE_UINT8, sizeof(data));
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestAppendInputData(
+          request, "INPUT0", data, sizeof(data), TRITONSERVER_MEMORY_CPU,
+          0 /* memory_type_id */),
+      "appending input data");
+  env.InferAsync(request, &completion);
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceResponseDelete(completion.Wait()),
+      "deleting response");
+  FAIL_IF_NOT(unavailable == 3, "stop from instance thread did not fail");
+
+  bool ready;
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerModelIsReady(env.server_, "loopback", -1, &ready),
+      "getting model readiness");
+  FAIL_IF_NOT(ready, "model not ready after failed unload");
+
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerUnloadModel(env.server_, "loopback"),
+      "unloading model");
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerModelIsReady(env.server_, "loopback", -1, &ready),
+      "getting model readiness");
+  FAIL_IF_NOT(!ready, "model ready after unload");
+  FAIL_IF_ERR(
+      TRITONSERVER_ServerLoadModel(env.server_, "loopback"), "loading model");
+  FAIL_IF_ERR(TRITONSERVER_InferenceRequestDelete(request), "deleting request");
+}
+
+// BYTES data converts between the length-prefixed and offsets layouts,
+// both directly and when a request and its response use different
+// layouts.
+void
+TestBytesLayoutConversion()
+{
+  const std::vector<std::string> elements{
+      "", "a", "triton", std::string(300, 'x')};
+  const std::string length_prefixed = LengthPrefixed(elements);
+  const std::string offsets = Offsets(elements);
+
+  FAIL_IF_NOT(
+      Convert(
+          TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED, length_prefixed,
+          elements.size(), TRITONSERVER_BYTES_LAYOUT_OFFSETS) == offsets,
+      "length-prefixed to offsets");
+  FAIL_IF_NOT(
+      Convert(
+          TRITONSERVER_BYTES_LAYOUT_OFFSETS, offsets, elements.size(),
+          TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED) == length_prefixed,
+      "offsets to length-prefixed");
+
+  // Data that is not a well-formed encoding is rejected.
+  size_t byte_size;
+  FAIL_IF_NOT(
+      IsError(
+          TRITONSERVER_BytesLayoutConvert(
+              TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED,
+              length_prefixed.data(), length_prefixed.size() - 1,
+              elements.size(), TRITONSERVER_BYTES_LAYOUT_OFFSETS,
+              nullptr /* dst */, 0, &byte_size),
+          TRITONSERVER_ERROR_INVALID_ARG),
+      "truncated length-prefixed data accepted");
+  FAIL_IF_NOT(
+      IsError(
+          TRITONSERVER_BytesLayoutConvert(
+              TRITONSERVER_BYTES_LAYOUT_OFFSETS, offsets.data(),
+              offsets.size(), elements.size() + 1,
+              TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED, nullptr /* dst */, 0,
+              &byte_size),
+          TRITONSERVER_ERROR_INVALID_ARG),
+      "offsets data with wrong element count accepted");
+
+  // Offsets in, length-prefixed out through the model.
+  Environment env(Settings{{"datatype", "BYTES"}});
+  TRITONSERVER_InferenceRequest* request =
+      env.CreateRequest(TRITONSERVER_TYPE_BYTES, elements.size());
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestSetInputBytesLayout(
+          request, "INPUT0", TRITONSERVER_BYTES_LAYOUT_OFFSETS),
+      "setting input layout");
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestAppendInputData(
+          request, "INPUT0", offsets.data(), offsets.size(),
+          TRITONSERVER_MEMORY_CPU, 0 /* memory_type_id */),
+      "appending input data");
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestAddRequestedOutput(request, "OUTPUT0"),
+      "requesting output");
+
+  Completion completion;
+  env.InferAsync(request, &completion);
+  TRITONSERVER_InferenceResponse* response = completion.Wait();
+  TRITONSERVER_BytesLayout layout;
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceResponseOutputBytesLayout(response, 0, &layout),
+      "getting output layout");
+  FAIL_IF_NOT(
+      layout == TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED,
+      "unexpected output layout");
+  FAIL_IF_NOT(
+      OutputData(response) == length_prefixed,
+      "output is not the length-prefixed input");
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceResponseDelete(response), "deleting response");
+
+  // And back, length-prefixed in and offsets out.
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestRemoveAllInputData(request, "INPUT0"),
+      "removing input data");
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestSetInputBytesLayout(
+          request, "INPUT0", TRITONSERVER_BYTES_LAYOUT_LENGTH_PREFIXED),
+      "setting input layout");
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestAppendInputData(
+          request, "INPUT0", length_prefixed.data(), length_prefixed.size(),
+          TRITONSERVER_MEMORY_CPU, 0 /* memory_type_id */),
+      "appending input data");
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceRequestSetRequestedOutputBytesLayout(
+          request, "OUTPUT0", TRITONSERVER_BYTES_LAYOUT_OFFSETS),
+      "setting output layout");
+
+  Completion completion2;
+  env.InferAsync(request, &completion2);
+  response = completion2.Wait();
+  FAIL_IF_NOT(OutputData(response) == offsets, "output is not offsets input");
+  FAIL_IF_ERR(
+      TRITONSERVER_InferenceResponseDelete(response), "deleting response");
+  FAIL_IF_ERR(TRITONSERVER_InferenceRequestDelete(request), "deleting request");
+}
+
+struct Test {
+  const char* name_;
+  void (*fn_)();
+};
+
+const Test kTests[] = {
+    {"InferAsyncRoundTrip", TestInferAsyncRoundTrip},
+    {"UnregisterRegionInFlight", TestUnregisterRegionInFlight},
+    {"UnloadFromInstanceThread", TestUnloadFromInstanceThread},
+    {"BytesLayoutConversion", TestBytesLayoutConversion},
+};
+
+}  // namespace
+
+int
+main(int argc, char** argv)
+{
+  const char* filter = (argc > 1) ? argv[1] : nullptr;
+  bool found = false;
+  for (const Test& test : kTests) {
+    if ((filter != nullptr) && (strcmp(filter, test.name_) != 0)) {
+      continue;
+    }
+    found = true;
+    printf("[ RUN      ] %s\n", test.name_);
+    fflush(stdout);
+    test.fn_();
+    printf("[       OK ] %s\n", test.name_);
+  }
+
+  if (!found) {
+    fprintf(stderr, "error: unknown test '%s'\n", filter);
+    return 1;
+  }
+  return 0;
+}